@@ -0,0 +1,70 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include "IArrayTexture.h"
+
+namespace	ExoRendererNull
+{
+
+class ArrayTexture : public ExoRenderer::IArrayTexture
+{
+public:
+	ArrayTexture(int width, int height, std::vector<std::string>& textures, ExoRenderer::TextureFilter filter);
+	virtual ~ArrayTexture(void);
+
+	virtual void initialize(int width, int height, std::vector<std::string>& textures, ExoRenderer::TextureFilter filter);
+	virtual void bind(int unit = 0) const;
+	virtual void unbind(void) const;
+
+	virtual int  appendLayer(const std::string& filePath);
+	virtual void replaceLayer(int layer, const std::string& filePath);
+	virtual void reserve(int capacity);
+
+	// Getters
+	int getId(void) const;
+	int getWidth(void) const;
+	int getHeight(void) const;
+	const std::vector<std::string> &getLayers(void) const;
+	virtual int getLayerCount(void) const;
+	virtual int getCapacity(void) const;
+	ExoRenderer::TextureFilter getFilter(void) const;
+	float getLodBias(void) const;
+	float getMinLod(void) const;
+	float getMaxLod(void) const;
+
+	// Setters
+	virtual void setLodBias(float bias);
+	virtual void setLodRange(float minLod, float maxLod);
+private:
+	int							_id;
+	int							_width, _height;
+	std::vector<std::string>	_layers;
+	int							_capacity;
+	ExoRenderer::TextureFilter	_filter;
+	float						_lodBias, _minLod, _maxLod;
+};
+
+}
@@ -0,0 +1,79 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <glm/vec2.hpp>
+
+#include "RenderStats.h"
+
+namespace	ExoRendererNull
+{
+
+enum class CommandType
+{
+	SPRITE,			// object: IArrayTexture, layer
+	GRID,
+	AXIS,
+	GUI_QUAD,		// object: ITexture
+	GLYPH,			// object: Label
+	BEGIN_SCISSOR,	// position, size
+	END_SCISSOR,
+	PUSH_PASS,		// name
+	POP_PASS
+};
+
+struct Command
+{
+	CommandType	type;
+	const void	*object;
+	const char	*name;
+	glm::vec2	position;
+	glm::vec2	size;
+	int			layer;
+};
+
+// Draw intent of one frame, in the order the OpenGL backend would issue it
+class CommandStream
+{
+public:
+	CommandStream(void);
+	~CommandStream(void);
+
+	Command	&push(CommandType type, const void *object = nullptr);
+	void	clear(void);
+
+	// Getters
+	const std::vector<Command>	&getCommands(void) const;
+	size_t						count(CommandType type) const;
+	ExoRenderer::RenderStats	&getStats(void);
+	const ExoRenderer::RenderStats	&getStats(void) const;
+private:
+	std::vector<Command>		_commands;
+	ExoRenderer::RenderStats	_stats;
+	const void					*_lastObject;
+};
+
+}
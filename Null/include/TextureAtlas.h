@@ -0,0 +1,54 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "ITextureAtlas.h"
+#include "Texture.h"
+
+namespace	ExoRendererNull
+{
+
+// Image sizes are unknown without decoding, every image gets its own texture
+class TextureAtlas : public ExoRenderer::ITextureAtlas
+{
+public:
+	TextureAtlas(int pageSize, int padding, ExoRenderer::TextureFilter filter);
+	virtual ~TextureAtlas(void);
+
+	virtual std::shared_ptr<ExoRenderer::ITexture>	add(const std::string& filePath);
+
+	// Getters
+	virtual size_t									getPageCount(void) const;
+	virtual std::shared_ptr<ExoRenderer::ITexture>	getPage(size_t index) const;
+	const std::vector<std::string>					&getImages(void) const;
+private:
+	std::vector<std::string>	_images;
+	ExoRenderer::TextureFilter	_filter;
+};
+
+}
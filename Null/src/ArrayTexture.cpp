@@ -0,0 +1,142 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "ArrayTexture.h"
+#include "Texture.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+ArrayTexture::ArrayTexture(int width, int height, std::vector<std::string>& textures, TextureFilter filter)
+: _id(Texture::generateId()), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f)
+{
+	initialize(width, height, textures, filter);
+}
+
+ArrayTexture::~ArrayTexture(void)
+{	}
+
+void ArrayTexture::initialize(int width, int height, std::vector<std::string>& textures, TextureFilter filter)
+{
+	_width = width;
+	_height = height;
+	_layers = textures;
+	_capacity = (int)textures.size();
+	_filter = filter;
+}
+
+void ArrayTexture::bind(int unit) const
+{
+	(void)unit;
+}
+
+void ArrayTexture::unbind(void) const
+{	}
+
+int ArrayTexture::appendLayer(const std::string& filePath)
+{
+	// Same growth as the GL backend
+	if ((int)_layers.size() == _capacity)
+		_capacity = std::max(_capacity * 2, 1);
+	_layers.push_back(filePath);
+	return (int)_layers.size() - 1;
+}
+
+void ArrayTexture::replaceLayer(int layer, const std::string& filePath)
+{
+	if (layer < 0 || layer >= (int)_layers.size())
+		throw (std::out_of_range("ArrayTexture has no layer " + std::to_string(layer)));
+	_layers[layer] = filePath;
+}
+
+void ArrayTexture::reserve(int capacity)
+{
+	_capacity = std::max(_capacity, capacity);
+}
+
+// Getters
+int ArrayTexture::getId(void) const
+{
+	return _id;
+}
+
+int ArrayTexture::getWidth(void) const
+{
+	return _width;
+}
+
+int ArrayTexture::getHeight(void) const
+{
+	return _height;
+}
+
+const std::vector<std::string> &ArrayTexture::getLayers(void) const
+{
+	return _layers;
+}
+
+int ArrayTexture::getLayerCount(void) const
+{
+	return (int)_layers.size();
+}
+
+int ArrayTexture::getCapacity(void) const
+{
+	return _capacity;
+}
+
+TextureFilter ArrayTexture::getFilter(void) const
+{
+	return _filter;
+}
+
+float ArrayTexture::getLodBias(void) const
+{
+	return _lodBias;
+}
+
+float ArrayTexture::getMinLod(void) const
+{
+	return _minLod;
+}
+
+float ArrayTexture::getMaxLod(void) const
+{
+	return _maxLod;
+}
+
+// Setters
+void ArrayTexture::setLodBias(float bias)
+{
+	_lodBias = bias;
+}
+
+void ArrayTexture::setLodRange(float minLod, float maxLod)
+{
+	_minLod = minLod;
+	_maxLod = maxLod;
+}
@@ -0,0 +1,100 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "CommandStream.h"
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+CommandStream::CommandStream(void)
+: _lastObject(nullptr)
+{	}
+
+CommandStream::~CommandStream(void)
+{	}
+
+Command &CommandStream::push(CommandType type, const void *object)
+{
+	_commands.push_back({type, object, nullptr, glm::vec2(0.0f), glm::vec2(0.0f), 0});
+
+	switch (type)
+	{
+		case CommandType::SPRITE:
+		case CommandType::GRID:
+		case CommandType::AXIS:
+		case CommandType::GUI_QUAD:
+		case CommandType::GLYPH:
+			_stats.drawCalls++;
+			_stats.instances++;
+			_stats.triangles += 2;
+
+			// Same cache as Texture::bindBuffer in the OpenGL backend
+			if (object && object != _lastObject)
+			{
+				_stats.textureBinds++;
+				_lastObject = object;
+			}
+			break;
+		case CommandType::BEGIN_SCISSOR:
+		case CommandType::END_SCISSOR:
+			_stats.scissorChanges++;
+			break;
+		default: break;
+	}
+
+	return _commands.back();
+}
+
+void CommandStream::clear(void)
+{
+	_commands.clear();
+	_stats.reset();
+	_lastObject = nullptr;
+}
+
+// Getters
+const std::vector<Command> &CommandStream::getCommands(void) const
+{
+	return _commands;
+}
+
+size_t CommandStream::count(CommandType type) const
+{
+	size_t	count = 0;
+
+	for (const Command &command : _commands)
+		if (command.type == type)
+			count++;
+	return count;
+}
+
+RenderStats &CommandStream::getStats(void)
+{
+	return _stats;
+}
+
+const RenderStats &CommandStream::getStats(void) const
+{
+	return _stats;
+}
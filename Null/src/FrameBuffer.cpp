@@ -0,0 +1,68 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "FrameBuffer.h"
+#include <stdexcept>
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+FrameBuffer::FrameBuffer(void) :
+	_width(-1), _height(-1)
+{	}
+
+FrameBuffer::~FrameBuffer(void)
+{	}
+
+// Same validation as the OpenGL backend, so misuse is caught on CI too
+void	FrameBuffer::attach(ITexture *texture)
+{
+	if (_width == -1)
+	{
+		_width = texture->getWidth();
+		_height = texture->getHeight();
+	}
+	else if (texture->getWidth() != _width ||
+		texture->getHeight() != _height)
+		throw (std::invalid_argument("texture size differes from framebuffer size"));
+}
+
+void	FrameBuffer::detach(ITexture *texture)
+{
+	(void)texture;
+}
+
+void	FrameBuffer::bind(void)
+{
+	if (_width == -1)
+		throw (std::logic_error("no texture binded to framebuffer"));
+}
+
+void	FrameBuffer::unbind(void)
+{	}
+
+void	FrameBuffer::clear(void)
+{
+	bind();
+}
@@ -0,0 +1,81 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "GamepadManager.h"
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+GamepadManager::GamepadManager(void)
+{
+	_fakeGamepad = new Gamepad();
+	_fakeGamepad->setIsGamepad(false);
+}
+
+GamepadManager::~GamepadManager(void)
+{
+	if (_fakeGamepad)
+		delete _fakeGamepad;
+
+	while (!_gamepadList.empty())
+	{
+		delete _gamepadList.back();
+		_gamepadList.pop_back();
+	}
+}
+
+void GamepadManager::add(int32_t id)
+{
+	(void)id;
+	_gamepadList.push_back(new Gamepad());
+}
+
+void GamepadManager::remove(int32_t id)
+{
+	if (id >= 0 && id < (int32_t)_gamepadList.size())
+	{
+		delete _gamepadList[id];
+		_gamepadList.erase(_gamepadList.begin() + id);
+	}
+}
+
+void GamepadManager::update(void)
+{
+	for (auto& gamepad : _gamepadList)
+		gamepad->updateLastBuffer();
+}
+
+// Getters
+unsigned int GamepadManager::getGamepadNumber(void)
+{
+	return (unsigned int)_gamepadList.size();
+}
+
+IGamepad *GamepadManager::getGamepad(unsigned int id)
+{
+	if (id < _gamepadList.size())
+		return _gamepadList[id];
+	else
+		return _fakeGamepad;
+}
@@ -0,0 +1,112 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Keyboard.h"
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+Keyboard::Keyboard()
+{	}
+
+Keyboard::~Keyboard()
+{	}
+
+void Keyboard::keyDown(const KeyboardKeys &id)
+{
+	if (id < KEY_MAX)
+		_buffer[id] = true;
+}
+
+void Keyboard::keyUp(const KeyboardKeys &id)
+{
+	if (id < KEY_MAX)
+		_buffer[id] = false;
+}
+
+bool Keyboard::isKeyDown(const KeyboardKeys &id) const
+{
+	if (id < KEY_MAX)
+		return _buffer[id];
+	else
+		return false;
+}
+
+bool Keyboard::lastIsKeyDown(const KeyboardKeys &id) const
+{
+	if (id < KEY_MAX)
+		return _lastBuffer[id];
+	else
+		return false;
+}
+
+const char* Keyboard::convertKeyboardKeyToChar(const KeyboardKeys &key) const
+{
+	switch (key)
+	{
+		case KEY_0:case KEY_KP_0:			return "0";
+		case KEY_1:case KEY_KP_1:			return "1";
+		case KEY_2:case KEY_KP_2:			return "2";
+		case KEY_3:case KEY_KP_3:			return "3";
+		case KEY_4:case KEY_KP_4:			return "4";
+		case KEY_5:case KEY_KP_5:			return "5";
+		case KEY_6:case KEY_KP_6:			return "6";
+		case KEY_7:case KEY_KP_7:			return "7";
+		case KEY_8:case KEY_KP_8:			return "8";
+		case KEY_9:case KEY_KP_9:			return "9";
+		case KEY_A:						 return "A";
+		case KEY_B:						 return "B";
+		case KEY_BACKSLASH:				 return "\\";
+		case KEY_C:						 return "C";
+		case KEY_D:						 return "D";
+		case KEY_E:						 return "E";
+		case KEY_F:						 return "F";
+		case KEY_G:						 return "G";
+		case KEY_H:						 return "H";
+		case KEY_I:						 return "I";
+		case KEY_J:						 return "J";
+		case KEY_K:						 return "K";
+		case KEY_L:						 return "L";
+		case KEY_M:						 return "M";
+		case KEY_N:						 return "N";
+		case KEY_O:						 return "O";
+		case KEY_P:						 return "P";
+		case KEY_Q:						 return "Q";
+		case KEY_R:						 return "R";
+		case KEY_S:						 return "S";
+		case KEY_SPACE:					 return " ";
+		case KEY_T:						 return "T";
+		case KEY_TAB:						return "\t";
+		case KEY_U:						 return "U";
+		case KEY_V:						 return "V";
+		case KEY_W:						 return "W";
+		case KEY_X:						 return "X";
+		case KEY_Y:						 return "Y";
+		case KEY_Z:						 return "Z";
+		case KEY_PERIOD:					return ".";
+		case KEY_COMMA:					 return ",";
+		case KEY_MINUS:case KEY_KP_MINUS:	return "-";
+		default:							return "";
+	}
+}
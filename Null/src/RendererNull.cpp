@@ -0,0 +1,734 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "RendererNull.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/geometric.hpp>
+#include <chrono>
+
+#include "Button.h"
+#include "Input.h"
+#include "Checkbox.h"
+#include "Select.h"
+#include "Slider.h"
+#include "Spinner.h"
+#include "Image.h"
+#include "View.h"
+#include "Light.h"
+#include "Profiler.h"
+#include "Utf8Iterator.h"
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+static RendererNull	*g_instance = nullptr;
+
+RendererNull&	RendererNull::Get(void)
+{
+	if (!g_instance)
+		g_instance = new RendererNull();
+	return *g_instance;
+}
+
+void			RendererNull::Destroy(void)
+{
+	if (g_instance)
+	{
+		delete g_instance;
+		g_instance = nullptr;
+	}
+}
+
+void RendererNull::initialize(const std::string& title, const int width, const int height, const WindowMode &mode, bool resizable)
+{
+	(void)resizable;
+
+	// Destroy if window already exist
+	if (_pWindow)
+		delete _pWindow;
+
+	_pWindow = new Window(title, width, height, mode);
+	resize();
+}
+
+void RendererNull::resize()
+{
+	_UIScaleFactor = _pWindow->getWidth() / REFRENCE_RESOLUTION_WIDTH;
+
+	_perspective = glm::perspective(glm::radians(90.0f), (float)(_pWindow->getWidth() / _pWindow->getHeight()), 0.1f, 100.f);
+	_orthographic = glm::ortho(0.0f, (float)_pWindow->getWidth(), (float)_pWindow->getHeight(), 0.0f, 0.0f, 1.0f);
+}
+
+// Create
+ICamera* RendererNull::createCamera(void)
+{
+	return new Camera();
+}
+
+IAxis* RendererNull::createAxis(void)
+{
+	return new IAxis();
+}
+
+ITexture* RendererNull::createTexture(const std::string& filePath, TextureFilter filter)
+{
+	return new Texture(filePath, filter);
+}
+
+ITexture* RendererNull::createTexture(unsigned int width, unsigned int height, TextureFormat format, TextureFilter filter)
+{
+	return new Texture(width, height, format, filter);
+}
+
+ITexture* RendererNull::createTextureAsync(const std::string& filePath, TextureFilter filter)
+{
+	// Nothing to decode, resident at once
+	return new Texture(filePath, filter);
+}
+
+IArrayTexture* RendererNull::createArrayTexture(int width, int height, std::vector<std::string> &textures, TextureFilter filter)
+{
+	return new ArrayTexture(width, height, textures, filter);
+}
+
+ITextureAtlas* RendererNull::createTextureAtlas(int pageSize, int padding, TextureFilter filter)
+{
+	return new TextureAtlas(pageSize, padding, filter);
+}
+
+Font* RendererNull::createDynamicFont(const std::string& filePath, unsigned int size)
+{
+	// Nothing is rasterised, the glyphs are empty
+	(void)filePath;
+	(void)size;
+	return new Font(std::make_shared<FntLoader>(""), std::shared_ptr<ITexture>(new Texture(1, 1, TextureFormat::RED, TextureFilter::LINEAR)));
+}
+
+ICursor* RendererNull::createCursor()
+{
+	return new Cursor();
+}
+
+ILabel* RendererNull::createLabel()
+{
+	return new Label();
+}
+
+IButton* RendererNull::createButton(const std::shared_ptr<ITexture> &texture, ButtonType buttonType, bool withLabel)
+{
+	return new Button(texture, buttonType, withLabel, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+ICheckbox* RendererNull::createCheckbox(const std::shared_ptr<ITexture> &texture, bool checked)
+{
+	return new Checkbox(texture, checked, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+IInput* RendererNull::createInput(const std::shared_ptr<ITexture> &texture, const std::string &text, InputType type)
+{
+	return new Input(type, texture, text, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+IImage* RendererNull::createImage(const std::shared_ptr<ITexture> &texture)
+{
+	return new Image(texture, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+ISpinner* RendererNull::createSpinner(const std::shared_ptr<ITexture> &texture)
+{
+	return new Spinner(texture, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+ISlider* RendererNull::createSlider(const std::shared_ptr<ITexture>& buttonTexture, const std::shared_ptr<ITexture>& barTexture)
+{
+	return new Slider(buttonTexture, barTexture, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+ISelect* RendererNull::createSelect(const std::shared_ptr<ITexture>& buttonTexture, const std::shared_ptr<ITexture>& backgroundTexture, const std::shared_ptr<ITexture>& scrollTexture, const std::shared_ptr<Font>& font)
+{
+	return new Select(buttonTexture, backgroundTexture, scrollTexture, font, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+IView* RendererNull::createView(const std::shared_ptr<ITexture>& scrollTexture, unsigned int numberOfRows, unsigned int numberOfColumns)
+{
+	return new View(scrollTexture, numberOfRows, numberOfColumns, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+IView* RendererNull::createView(const std::shared_ptr<ITexture>& backgroundTexture, const std::shared_ptr<ITexture>& scrollTexture, unsigned int numberOfRows, unsigned int numberOfColumns)
+{
+	return new View(backgroundTexture, scrollTexture, numberOfRows, numberOfColumns, _UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+}
+
+ILight	*RendererNull::createOrthogonalLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const glm::vec2 &x, const glm::vec2 &y, const glm::vec2 &z)
+{
+	(void)x; (void)y; (void)z;
+	return new Light(ILight::DEFAULT_LIGHT, ambient, diffuse, pos, dir, up);
+}
+
+ILight	*RendererNull::createPerspectivelLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const float &fovy, const float &aspect, const float &near, const float &far)
+{
+	(void)fovy; (void)aspect; (void)near; (void)far;
+	return new Light(ILight::DEFAULT_LIGHT, ambient, diffuse, pos, dir, up);
+}
+
+ILight	*RendererNull::createPointLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const float &fovy, const float &aspect, const float &near, const float &far)
+{
+	(void)fovy; (void)aspect; (void)near; (void)far;
+	return new Light(ILight::POINT_LIGHT, ambient, diffuse, pos, dir, up);
+}
+
+IFrameBuffer	*RendererNull::createFrameBuffer(void)
+{
+	return new FrameBuffer();
+}
+
+// Push
+void RendererNull::add(sprite &s)
+{
+	_sprites.push_back(s);
+}
+
+void RendererNull::add(IWidget *widget)
+{
+	EXO_PROFILE_ZONE("IWidget::update");
+
+	widget->update(getMouse(), getKeyboard(), getGamepadManager()->getGamepad(0), getNavigationType());
+
+	// Update
+	switch (widget->getType())
+	{
+		case IWidget::BUTTON: {
+			auto button = (Button*)widget;
+			if (button->getLabel())
+				add(button->getLabel());
+			break;
+		}
+		case IWidget::SELECT: {
+			auto select = (Select*)widget;
+			add(select->getLabel());
+			break;
+		}
+		case IWidget::INPUT: {
+			auto input = (Input*)widget;
+			add(input->getLabel());
+			break;
+		}
+		case IWidget::SPINNER: {
+			auto spinner = (Spinner*)widget;
+			spinner->update(_pWindow->getDelta());
+			break;
+		}
+		default: break;
+	}
+
+	_widgets.push_back(widget);
+}
+
+void RendererNull::add(ILabel *label)
+{
+	label->contextInfo(_UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+	_labels.push_back((Label*)label);
+}
+
+void RendererNull::add(std::shared_ptr<ILight> &light)
+{
+}
+
+// Pop
+void RendererNull::remove(sprite &s)
+{
+	for (std::deque<sprite>::iterator iterator = _sprites.begin(); iterator != _sprites.end(); iterator++)
+	{
+		if (*iterator == s)
+		{
+			_sprites.erase(iterator);
+			return ;
+		}
+	}
+}
+
+void RendererNull::remove(IWidget *widget)
+{
+	switch (widget->getType())
+	{
+		case IWidget::BUTTON: {
+			auto button = (Button*)widget;
+			remove(button->getLabel());
+			break;
+		}
+		case IWidget::SELECT: {
+			auto select = (Select*)widget;
+			remove(select->getLabel());
+			break;
+		}
+		case IWidget::INPUT: {
+			auto input = (Input*)widget;
+			remove(input->getLabel());
+			break;
+		}
+		default: break;
+	}
+
+	for (std::deque<IWidget*>::iterator iterator = _widgets.begin(); iterator != _widgets.end(); iterator++)
+	{
+		if (*iterator == widget)
+		{
+			_widgets.erase(iterator);
+			return ;
+		}
+	}
+}
+
+void RendererNull::remove(ILabel *label)
+{
+	for (std::deque<Label*>::iterator iterator = _labels.begin(); iterator != _labels.end(); iterator++)
+	{
+		if (*iterator == label)
+		{
+			_labels.erase(iterator);
+			return ;
+		}
+	}
+}
+
+void RendererNull::remove(std::shared_ptr<ILight> &light)
+{
+}
+
+void RendererNull::draw(void)
+{
+	EXO_PROFILE_ZONE("RendererNull::draw");
+
+	_commands.clear();
+	record(_commands);
+}
+
+void RendererNull::swap(void)
+{
+	EXO_PROFILE_ZONE("RendererNull::swap");
+
+	draw();
+
+	_mouse.updateLastBuffer();
+	_keyboard.updateLastBuffer();
+	_gamepad.update();
+
+	if (_pCursor)
+		_pCursor->update();
+
+	_stats = _commands.getStats();
+	_statsHistory.push(_stats);
+
+	_pWindow->updateDelta();
+}
+
+// Getters
+IWindow* RendererNull::getWindow(void)
+{
+	return _pWindow;
+}
+
+IKeyboard* RendererNull::getKeyboard(void)
+{
+	return &_keyboard;
+}
+
+IMouse* RendererNull::getMouse(void)
+{
+	return &_mouse;
+}
+
+IGamepadManager* RendererNull::getGamepadManager(void)
+{
+	return &_gamepad;
+}
+
+unsigned int RendererNull::getTime(void) const
+{
+	static const std::chrono::steady_clock::time_point	start = std::chrono::steady_clock::now();
+
+	return (unsigned int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool RendererNull::isRenderThreadEnabled(void) const
+{
+	return false;
+}
+
+bool RendererNull::isGPUProfilingEnabled(void) const
+{
+	return false;
+}
+
+std::vector<GPUPass> RendererNull::getGPUPasses(void)
+{
+	return std::vector<GPUPass>();
+}
+
+RenderStats RendererNull::getStats(void)
+{
+	return _stats;
+}
+
+RenderStatsHistory RendererNull::getStatsHistory(void)
+{
+	return _statsHistory;
+}
+
+void RendererNull::readFrame(std::vector<unsigned char> &pixels)
+{
+	// Nothing is rasterized, the frame is the cleared target
+	pixels.assign((size_t)_pWindow->getContextWidth() * _pWindow->getContextHeight() * 4, 0);
+	for (size_t i = 3; i < pixels.size(); i += 4)
+		pixels[i] = 255;
+}
+
+MemoryReport RendererNull::getMemoryReport(void)
+{
+	MemoryReport	report;
+
+	// Nothing is allocated on a GPU
+	report.budget = _memoryBudget;
+	return report;
+}
+
+const CommandStream &RendererNull::getCommands(void) const
+{
+	return _commands;
+}
+
+// Setters
+void RendererNull::setCursor(ICursor* cursor)
+{
+	_pCursor = (Cursor*)cursor;
+}
+
+void RendererNull::setMousePicker(MousePicker* picker)
+{
+	_pMousePicker = picker;
+}
+
+void RendererNull::setAxis(IAxis* axis)
+{
+	_pAxis = axis;
+}
+
+void RendererNull::setGridEnable(bool val)
+{
+	_gridEnabled = val;
+}
+
+void RendererNull::setRenderThread(bool enabled)
+{
+	// Recording is synchronous, there is no context to hand over
+	(void)enabled;
+}
+
+void RendererNull::setGPUProfiling(bool enabled)
+{
+	(void)enabled;
+}
+
+void RendererNull::setTextureUploadBudget(size_t bytes)
+{
+	(void)bytes;
+}
+
+void RendererNull::setMemoryBudget(uint64_t bytes, unsigned int idleFrames)
+{
+	(void)idleFrames;
+	_memoryBudget = bytes;
+}
+
+// Private
+RendererNull::RendererNull(void)
+: IRenderer(), _pWindow(nullptr), _gridEnabled(false), _memoryBudget(0), _pCursor(nullptr)
+{	}
+
+RendererNull::~RendererNull(void)
+{
+	if (_pWindow)
+		delete _pWindow;
+
+	if (_pCursor)
+		delete _pCursor;
+}
+
+// Same walk as RendererSDLOpenGL::record
+void RendererNull::record(CommandStream& commands)
+{
+	commands.getStats().frameTime = _pWindow->getDelta();
+
+	if (_pCurrentCamera)
+	{
+		if (_pMousePicker)
+			_pMousePicker->update((IMouse*)&_mouse, _pWindow->getWidth(), _pWindow->getHeight(), ((Camera*)_pCurrentCamera)->getLookAt(), _perspective);
+
+		recordSprites(commands);
+
+		if (_pAxis)
+			commands.push(CommandType::AXIS).position = _pAxis->getPosition();
+	}
+
+	// GUI
+	commands.push(CommandType::PUSH_PASS).name = "GUIRenderer";
+	for (IWidget* widget : _widgets)
+		record(commands, widget);
+
+	// Front
+	for (IWidget* widget : _frontWidgets)
+		if (widget->getType() == IWidget::SELECT)
+			record(commands, ((Select*)widget)->getView());
+	_frontWidgets.clear();
+	commands.push(CommandType::POP_PASS);
+
+	// Text
+	commands.push(CommandType::PUSH_PASS).name = "TextRenderer";
+	for (Label* label : _labels)
+		record(commands, label);
+	commands.push(CommandType::POP_PASS);
+}
+
+void RendererNull::recordSprites(CommandStream& commands)
+{
+	glm::mat4 viewProjection = _perspective * ((Camera*)_pCurrentCamera)->getLookAt();
+	glm::vec4 planes[6];
+
+	commands.push(CommandType::PUSH_PASS).name = "ObjectRenderer";
+	if (_gridEnabled)
+		commands.push(CommandType::GRID);
+
+	// Frustum planes (left, right, bottom, top, near, far)
+	for (int i = 0; i < 3; i++)
+	{
+		glm::vec4 row(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+		glm::vec4 w(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+		planes[i * 2] = w + row;
+		planes[i * 2 + 1] = w - row;
+	}
+
+	for (sprite& object : _sprites)
+	{
+		if (!isVisible(planes, object))
+		{
+			commands.getStats().spritesCulled++;
+			continue ;
+		}
+		commands.getStats().spritesDrawn++;
+
+		Command &command = commands.push(CommandType::SPRITE, object.texture.get());
+		command.position = object.position;
+		command.size = object.scale;
+		command.layer = object.layer;
+	}
+
+	commands.push(CommandType::POP_PASS);
+}
+
+unsigned char RendererNull::record(CommandStream& commands, IWidget* widget)
+{
+	commands.getStats().widgets++;
+
+	switch (widget->getType())
+	{
+		case IWidget::BUTTON: {
+			auto button = (Button*)widget;
+			if (button->getSliced())
+				recordSliced(commands, button->getTexture(), button->getRealPosition() + button->getVirtualOffset() + button->getRelativeParentPosition(), button->getScaleSize());
+			else
+				recordQuad(commands, button->getTexture(), button->getRealPosition() + button->getVirtualOffset() + button->getRelativeParentPosition(), button->getScaleSize());
+			return 0;
+		}
+		case IWidget::CHECKBOX: {
+			auto checkbox = (Checkbox*)widget;
+			recordQuad(commands, checkbox->getTexture(), checkbox->getRealPosition() + checkbox->getVirtualOffset() + checkbox->getRelativeParentPosition(), checkbox->getScaleSize());
+			return 0;
+		}
+		case IWidget::SELECT: {
+			auto select = (Select*)widget;
+			if (select->isOpen())
+				_frontWidgets.push_back(select);
+			return record(commands, select->getButton());
+		}
+		case IWidget::INPUT: {
+			auto input = (Input*)widget;
+			if (input->getSliced())
+				recordSliced(commands, input->getTexture(), input->getRealPosition() + input->getVirtualOffset() + input->getRelativeParentPosition(), input->getScaleSize());
+			else
+				recordQuad(commands, input->getTexture(), input->getRealPosition() + input->getVirtualOffset() + input->getRelativeParentPosition(), input->getScaleSize());
+			return 0;
+		}
+		case IWidget::SLIDER: {
+			auto slider = (Slider*)widget;
+			record(commands, slider->getBarImage());
+			record(commands, slider->getSliderButton());
+			return 0;
+		}
+		case IWidget::IMAGE: {
+			auto image = (Image*)widget;
+			recordQuad(commands, image->getTexture(), image->getRealPosition() + image->getVirtualOffset() + image->getRelativeParentPosition(), image->getScaleSize());
+			return 0;
+		}
+		case IWidget::SPINNER: {
+			auto spinner = (Spinner*)widget;
+			recordQuad(commands, spinner->getTexture(), spinner->getRealPosition() + spinner->getVirtualOffset() + spinner->getRelativeParentPosition(), spinner->getScaleSize());
+			return 0;
+		}
+		case IWidget::VIEW: {
+			record(commands, (View*)widget);
+			return 1;
+		}
+		default: return 0;
+	}
+}
+
+void RendererNull::record(CommandStream& commands, View* view)
+{
+	glm::vec2 position = view->getRealPosition() + view->getVirtualOffset() + view->getRelativeParentPosition();
+
+	commands.push(CommandType::PUSH_PASS).name = "View";
+
+	// Render background
+	if (view->getBackgroundTexture().get() != nullptr)
+		recordQuad(commands, view->getBackgroundTexture(), position, view->getScaleSize());
+
+	// Render scroll
+	if (view->getLastScrollHeight() > view->getRealPosition().y + view->getRelativeParentPosition().y + view->getScaleSize().y)
+		record(commands, view->getScrollbarButton());
+
+	// Render childs
+	Command &scissor = commands.push(CommandType::BEGIN_SCISSOR);
+	scissor.position = position - view->getScaleSize();
+	scissor.size = view->getScaleSize() * 2.0f;
+
+	std::deque<Label*> labels;
+	for (IWidget* widget : view->getRenderQueue())
+	{
+		switch (widget->getType())
+		{
+			case IWidget::SELECT:
+				labels.push_back(((Select*)widget)->getLabel());
+				break;
+			case IWidget::BUTTON:
+				labels.push_back(((Button*)widget)->getLabel());
+				break;
+			case IWidget::INPUT:
+				labels.push_back(((Input*)widget)->getLabel());
+				break;
+			default: break;
+		}
+
+		record(commands, widget);
+	}
+
+	for (Label* label : view->getLabelRenderQueue())
+	{
+		label->contextInfo(_UIScaleFactor, _pWindow->getWidth(), _pWindow->getHeight());
+		labels.push_back(label);
+	}
+	for (Label* label : labels)
+		if (label)
+			record(commands, label);
+
+	commands.push(CommandType::END_SCISSOR);
+	commands.push(CommandType::POP_PASS);
+}
+
+// Same layout as TextRenderer::recordCharacter
+void RendererNull::record(CommandStream& commands, Label* label)
+{
+	const std::vector<TextLine> &lines = label->getLines();
+	const std::string &text = label->getText();
+	glm::vec2 origin = label->getRealPosition() + label->getVirtualOffset() + label->getRelativeParentPosition();
+
+	for (size_t line = 0; line < lines.size(); line++)
+	{
+		float x = origin.x;
+		float y = origin.y + line * TEXT_LINE_HEIGHT * label->getFontScale();
+		uint32_t previous = 0;
+
+		for (Utf8Iterator characters(text, lines[line].begin, lines[line].end); characters.hasNext();)
+		{
+			uint32_t c = characters.next();
+
+			x += label->getFont()->getKerning(previous, c) * label->getFontScale();
+			previous = c;
+			if (c == ' ') // Space
+			{
+				x += TEXT_SPACE_ADVANCE * label->getFontScale();
+				continue ;
+			}
+
+			const CharDescriptor &ch = label->getFont()->getCharacter(c);
+
+			Command &glyph = commands.push(CommandType::GLYPH, label->getFont()->getTexture().get());
+			glyph.object = label;
+			glyph.position = glm::vec2(x + ch.xOffset * label->getFontScale(), y + ch.yOffset * label->getFontScale());
+			glyph.size = glm::vec2(ch.width, ch.height) * label->getFontScale();
+			commands.getStats().glyphs++;
+
+			x += ch.xAdvance * label->getFontScale();
+		}
+	}
+}
+
+void RendererNull::recordQuad(CommandStream& commands, const std::shared_ptr<ITexture>& texture, const glm::vec2& position, const glm::vec2& size)
+{
+	Command &command = commands.push(CommandType::GUI_QUAD, texture.get());
+
+	command.position = position;
+	command.size = size;
+}
+
+// Nine quads, like GUIRenderer::drawSliced
+void RendererNull::recordSliced(CommandStream& commands, const std::shared_ptr<ITexture>& texture, const glm::vec2& position, const glm::vec2& size)
+{
+	float cornerSize = (size.y > size.x ? size.x : size.y) / 3.0f;
+
+	for (int row = -1; row <= 1; row++)
+		for (int column = -1; column <= 1; column++)
+		{
+			glm::vec2 sliceSize(column == 0 ? size.x - cornerSize * 2 : cornerSize, row == 0 ? size.y - cornerSize * 2 : cornerSize);
+			glm::vec2 slicePosition(position.x + column * (size.x - cornerSize), position.y + row * (size.y - cornerSize));
+
+			recordQuad(commands, texture, slicePosition, sliceSize);
+		}
+}
+
+bool RendererNull::isVisible(const glm::vec4 planes[6], const sprite& s)
+{
+	// Bounding circle of the unit quad once scaled, rotation doesn't matter
+	glm::vec3 center(s.position, 0.0f);
+	float radius = 0.5f * glm::length(s.scale);
+
+	for (int i = 0; i < 6; i++)
+	{
+		glm::vec3 normal(planes[i]);
+
+		if (glm::dot(normal, center) + planes[i].w < -radius * glm::length(normal))
+			return false;
+	}
+	return true;
+}
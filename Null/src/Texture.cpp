@@ -0,0 +1,119 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Texture.h"
+
+#include <atomic>
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+Texture::Texture(unsigned int width, unsigned int height, TextureFormat format, TextureFilter filter)
+: _id(generateId()), _width(width), _height(height), _format(format), _filter(filter), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f)
+{	}
+
+Texture::Texture(const std::string& filePath, TextureFilter filter)
+: _id(generateId()), _width(0), _height(0), _format(RGBA), _filter(filter), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f), _filePath(filePath)
+{	}
+
+Texture::~Texture(void)
+{	}
+
+void Texture::bind(int unit) const
+{
+	(void)unit;
+}
+
+void Texture::unbind(void) const
+{	}
+
+// Getters
+int Texture::getEngineId(void) const
+{
+	return _id;
+}
+
+int Texture::getWidth(void) const
+{
+	return _width;
+}
+
+int Texture::getHeight(void) const
+{
+	return _height;
+}
+
+bool Texture::isResident(void) const
+{
+	return true;
+}
+
+const std::string &Texture::getFilePath(void) const
+{
+	return _filePath;
+}
+
+TextureFormat Texture::getFormat(void) const
+{
+	return _format;
+}
+
+TextureFilter Texture::getFilter(void) const
+{
+	return _filter;
+}
+
+float Texture::getLodBias(void) const
+{
+	return _lodBias;
+}
+
+float Texture::getMinLod(void) const
+{
+	return _minLod;
+}
+
+float Texture::getMaxLod(void) const
+{
+	return _maxLod;
+}
+
+// Setters
+void Texture::setLodBias(float bias)
+{
+	_lodBias = bias;
+}
+
+void Texture::setLodRange(float minLod, float maxLod)
+{
+	_minLod = minLod;
+	_maxLod = maxLod;
+}
+
+int Texture::generateId(void)
+{
+	static std::atomic<int>	id(0);
+
+	return ++id;
+}
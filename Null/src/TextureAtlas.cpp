@@ -0,0 +1,62 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "TextureAtlas.h"
+
+#include <stdexcept>
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+TextureAtlas::TextureAtlas(int pageSize, int padding, TextureFilter filter)
+: _filter(filter)
+{
+	(void)pageSize;
+	(void)padding;
+}
+
+TextureAtlas::~TextureAtlas(void)
+{	}
+
+std::shared_ptr<ITexture> TextureAtlas::add(const std::string& filePath)
+{
+	_images.push_back(filePath);
+	return std::make_shared<Texture>(filePath, _filter);
+}
+
+// Getters
+size_t TextureAtlas::getPageCount(void) const
+{
+	return 0;
+}
+
+std::shared_ptr<ITexture> TextureAtlas::getPage(size_t index) const
+{
+	throw (std::out_of_range("TextureAtlas has no page " + std::to_string(index)));
+}
+
+const std::vector<std::string> &TextureAtlas::getImages(void) const
+{
+	return _images;
+}
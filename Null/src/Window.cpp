@@ -0,0 +1,153 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Window.h"
+
+#include <chrono>
+
+using namespace ExoRenderer;
+using namespace ExoRendererNull;
+
+Window::Window(const std::string &title, uint32_t width, uint32_t height, const WindowMode &mode)
+: IWindow(), _pFrameTexture(nullptr), _pFrameBuffer(nullptr)
+{
+	(void)title;
+
+	_width = width;
+	_height = height;
+	_contextWidth = width;
+	_contextHeight = height;
+	_windowMode = mode;
+
+	updateDelta();
+	_last = _now;
+
+	initPostProcessing();
+}
+
+Window::~Window(void)
+{
+	if (_pFrameBuffer)
+		delete _pFrameBuffer;
+
+	if (_pFrameTexture)
+		delete _pFrameTexture;
+}
+
+void Window::updateDelta(void)
+{
+	_last = _now;
+	_now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Window::close(void)
+{
+	_close = true;
+}
+
+// Setters
+void Window::setWindowSize(int w, int h)
+{
+	_width = w;
+	_height = h;
+	_contextWidth = w;
+	_contextHeight = h;
+
+	initPostProcessing();
+}
+
+void Window::setWindowMode(const WindowMode &mode)
+{
+	_windowMode = mode;
+}
+
+void Window::setVsync(bool vsync)
+{
+	(void)vsync;
+}
+
+IFrameBuffer *Window::getFrameBuffer(void) const
+{
+	return (_pFrameBuffer);
+}
+
+// Getters
+double Window::getDelta(void) const
+{
+	return (double)(_now - _last) / 1000000.0;
+}
+
+float Window::getWidth(void) const
+{
+	return _width;
+}
+
+float Window::getHeight(void) const
+{
+	return _height;
+}
+
+int Window::getContextWidth(void) const
+{
+	return _contextWidth;
+}
+
+int Window::getContextHeight(void) const
+{
+	return _contextHeight;
+}
+
+int Window::getHighDPIFactor(void) const
+{
+	return _highDPIFactor;
+}
+
+bool Window::isFullscreen(void) const
+{
+	return _windowMode == WindowMode::FULLSCREEN;
+}
+
+bool Window::isHeadless(void) const
+{
+	return true;
+}
+
+bool Window::getIsClosing(void) const
+{
+	return _close;
+}
+
+// Private
+void Window::initPostProcessing(void)
+{
+	if (_pFrameBuffer)
+		delete _pFrameBuffer;
+
+	if (_pFrameTexture)
+		delete _pFrameTexture;
+
+	_pFrameTexture = new Texture(_contextWidth, _contextHeight, RGBA, NEAREST);
+	_pFrameBuffer = new FrameBuffer();
+	_pFrameBuffer->attach(_pFrameTexture);
+}
@@ -24,11 +24,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <SDL2/SDL_image.h>
 
 #include "Enums.h"
 #include "IArrayTexture.h"
+#include "ThreadPool.h"
 #include "Texture.h"
 #include "OGLCall.h"
 
@@ -39,7 +41,8 @@ class ArrayTexture: public ExoRenderer::IArrayTexture
 {
 public:
 	ArrayTexture(void);
-	ArrayTexture(int width, int height, std::vector<std::string>& textures, ExoRenderer::TextureFilter filter);
+	// Layers are decoded on the workers when given, which must outlive initialize()
+	ArrayTexture(int width, int height, std::vector<std::string>& textures, ExoRenderer::TextureFilter filter, ExoRenderer::ThreadPool *workers = nullptr);
 	virtual ~ArrayTexture(void);
 
 	virtual void initialize(int width, int height, std::vector<std::string>& textures, ExoRenderer::TextureFilter filter);
@@ -47,14 +50,43 @@ public:
 	virtual void bind(int unit = 0) const;
 	virtual void unbind(void) const;
 
+	// Grows twice as large when full, see reserve(). RGBA8 arrays only.
+	virtual int  appendLayer(const std::string& filePath);
+	virtual void replaceLayer(int layer, const std::string& filePath);
+	virtual void reserve(int capacity);
+
+	// Setters
+	virtual void setLodBias(float bias);
+	virtual void setLodRange(float minLod, float maxLod);
+
 	// Getters
 	unsigned int getBuffer(void) const;
+	virtual int getLayerCount(void) const;
+	virtual int getCapacity(void) const;
+	virtual uint64_t getAllocatedBytes(void) const;
 
 	const GLuint	&getId(void) const;
 private:
-	static void applyFilter(const ExoRenderer::TextureFilter& filter);
+	void		initializeContainer(int width, int height, std::vector<std::string>& textures, ExoRenderer::TextureFilter filter);
+	void		uploadLayer(int layer, SDL_Surface *image);
+	void		grow(int capacity);
+	void		copyLayers(GLuint source, int layers);	// Every level
+	void		applySampler(void) const;
+	void		setAllocated(uint64_t bytes);
+	SDL_Surface	*decodeLayer(const std::string &filePath) const;
+
+	// RGBA32, nullptr with an error when the size doesn't match
+	static SDL_Surface	*decodeLayer(const std::string &filePath, int width, int height, std::string &error);
 private:
-	GLuint	_id;
+	ExoRenderer::ThreadPool	*_pWorkers;
+	GLuint					_id;
+	GLenum					_format;	// Internal format
+	ExoRenderer::TextureFilter	_filter;
+	int						_width, _height;
+	int						_layers, _capacity;
+	int						_levels;	// Allocated per layer
+	float					_lodBias, _minLod, _maxLod;	// GL thread only
+	std::atomic<uint64_t>	_bytes;		// Accounted to GPUMemory
 };
 
 }
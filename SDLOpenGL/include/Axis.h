@@ -42,9 +42,9 @@ class Axis : public ExoRenderer::IAxis
 		Axis(void);
 		virtual ~Axis(void);
 
-		void render(const glm::mat4& lookAt, const glm::mat4& perspective);
+		static void render(const glm::vec2 &position, ExoRenderer::AxisType type, const glm::mat4& lookAt, const glm::mat4& perspective);
 	private:
-	void drawAxis(int x, int y, float angle, const glm::vec3 &color, const glm::mat4& lookAt, const glm::mat4& perspective);
+	static void drawAxis(const glm::vec2 &position, ExoRenderer::AxisType type, int x, int y, float angle, const glm::vec3 &color, const glm::mat4& lookAt, const glm::mat4& perspective);
 	public:
 		static Shader* pShader;
 
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "Enums.h"
 #include "OGLCall.h"
 
@@ -39,6 +41,10 @@ public:
 
 	virtual void initialize(unsigned long count, unsigned int size, const void* data, ExoRenderer::BufferType type, ExoRenderer::BufferDraw usage, unsigned char attribArray, bool normalized);
 	virtual void updateSubData(unsigned long count, const void* data);
+	// Orphans the storage then uploads, grown to fit, for data rewritten every frame
+	virtual void stream(unsigned long count, const void* data);
+	// Interleaved layout of an ARRAYBUFFER, stride and offset in floats, the vertex array is bound
+	virtual void setAttribute(unsigned char attribArray, unsigned int size, unsigned int stride, unsigned int offset, bool normalized);
 
 	virtual void bind(void) const;
 	virtual void unbind(void) const;
@@ -48,6 +54,7 @@ public:
 private:
 	unsigned long _count;
 	ExoRenderer::BufferType _type;
+	uint64_t _bytes;
 
 	GLuint _id;
 };
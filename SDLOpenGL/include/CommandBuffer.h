@@ -0,0 +1,105 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <glm/mat4x4.hpp>
+
+#include "OGLCall.h"
+#include "RenderStats.h"
+
+namespace	ExoRendererSDLOpenGL
+{
+
+enum class RenderCommandType : unsigned char
+{
+	BLEND,			// param[0]: enable
+	BEGIN_OBJECTS,	// matrix: projection, matrix + 1: view
+	SPRITE,			// texture, matrix: model, param[0]: layer, param[1]/param[2]: flip
+	GRID,			// object: Grid, matrix: projection, matrix + 1: view
+	AXIS,			// matrix: projection, matrix + 1: view, param[0]: type, value: position
+	BEGIN_GUI,		// matrix: projection
+	GUI_QUAD,		// texture, matrix: transformation, value: opacity, uv scale, uv offset
+	BEGIN_TEXT,		// matrix: projection
+	GLYPHS,			// texture, param: region of a DynamicFont atlas, first: its coverage (pushPixels)
+	TEXT,			// texture, first/count: glyph quads of every label using it, param[0]: FontType,
+					// value: distance range, outline width, shadow offset, param[1]: vertices of the outline and shadow colors
+	BEGIN_SCISSOR,	// param: box
+	END_SCISSOR,	// param: box to restore
+	PUSH_PASS,		// object: static pass name
+	POP_PASS
+};
+
+// A compact, self-contained draw instruction: everything needed to execute it
+// is copied at record time so it can be replayed on another thread.
+struct RenderCommand
+{
+	RenderCommandType	type;
+	GLuint				texture;
+	unsigned int		matrix;
+	unsigned int		first;
+	unsigned int		count;
+	int					param[4];
+	float				value[6];
+	const void			*object;
+};
+
+class CommandBuffer
+{
+public:
+	CommandBuffer(void);
+	~CommandBuffer(void);
+
+	void			clear(void);
+
+	RenderCommand	&push(RenderCommandType type);
+	unsigned int	pushMatrix(const glm::mat4 &matrix);
+	unsigned int	pushVertices(const float *vertices, unsigned int count);
+	unsigned int	pushPixels(const unsigned char *pixels, unsigned int count);	// Appended to the previous ones
+
+	// Getters
+	const std::vector<RenderCommand>	&getCommands(void) const;
+	const glm::mat4	&getMatrix(unsigned int index) const;
+	const float		*getVertices(unsigned int first) const;
+	const unsigned char	*getPixels(unsigned int first) const;
+	bool			isEmpty(void) const;
+	unsigned long	getFrame(void) const;
+
+	// Counters known at record time (widgets, glyphs, culling, frame time)
+	ExoRenderer::RenderStats		&getStats(void);
+	const ExoRenderer::RenderStats	&getStats(void) const;
+
+	// Setters
+	void			setFrame(unsigned long frame);	// Counted from 1 by the renderer, kept by clear()
+private:
+	std::vector<RenderCommand>	_commands;
+	std::vector<glm::mat4>		_matrices;
+	std::vector<float>			_vertices;
+	std::vector<unsigned char>	_pixels;
+	ExoRenderer::RenderStats	_stats;
+	unsigned long				_frame;
+};
+
+}
@@ -0,0 +1,126 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <SDL2/SDL_ttf.h>
+
+#include "Font.h"
+#include "RectPacker.h"
+#include "ThreadPool.h"
+#include "CommandBuffer.h"
+
+// Width of the glyph atlas, its height grows a page at a time
+#define DYNAMIC_FONT_ATLAS_WIDTH	1024
+// Height of an atlas page, the unit of eviction. Taller glyphs are drawn empty.
+#define DYNAMIC_FONT_PAGE_HEIGHT	128
+// Pages at most, the least recently drawn one is evicted past that. One bit each in Font::getPages.
+#define DYNAMIC_FONT_MAX_PAGES		8
+// Empty pixels around each glyph, so filtering doesn't pick up its neighbours
+#define DYNAMIC_FONT_PADDING		1
+
+namespace	ExoRendererSDLOpenGL
+{
+
+// Font rasterising its glyphs from a TrueType file on demand, for text no prebaked atlas
+// covers. A glyph is drawn empty until its worker has rasterised it, the font then packs
+// it into its atlas (FONT_BITMAP) on the game thread and uploads what changed once per frame.
+// Kerning isn't applied, the face is only ever used by the worker.
+class DynamicFont : public ExoRenderer::Font
+{
+public:
+	DynamicFont(const std::string& filePath, unsigned int size);
+	virtual ~DynamicFont(void);
+
+	// Game thread
+	virtual const ExoRenderer::CharDescriptor& getCharacter(uint32_t character) const;
+	virtual float getKerning(uint32_t first, uint32_t second) const;
+	virtual unsigned int getGeneration() const;
+	virtual uint32_t getPages(uint32_t character) const;
+	virtual void touch(uint32_t pages) const;
+
+	// Game thread, before laying out: packs the rasterised glyphs and records their upload,
+	// once per CommandBuffer::getFrame however many text renderers draw the font
+	void		update(CommandBuffer& commands);
+	// GL thread, a GLYPHS command
+	static void	upload(const RenderCommand& command, const CommandBuffer& commands);
+
+	// Getters
+	size_t		getGlyphCount(void) const;
+	size_t		getPageCount(void) const;
+private:
+	// Coverage of a glyph trimmed to its ink, from a worker
+	struct Bitmap
+	{
+		uint32_t					character;
+		int							width, height;
+		float						xOffset, yOffset, xAdvance;
+		std::vector<unsigned char>	coverage;
+	};
+
+	struct Glyph
+	{
+		ExoRenderer::CharDescriptor	descriptor;
+		int							page;	// -1 while rasterised, or without ink
+		int							x, y;	// In the atlas, in pixels
+
+		Glyph(void) : page(-1), x(0), y(0) { }
+	};
+
+	struct Page
+	{
+		ExoRenderer::RectPacker		packer;
+		unsigned long				lastUsed;	// Frame a glyph of the page was last looked up or drawn
+	};
+
+	void	rasterise(uint32_t character) const;	// Worker
+	void	place(const Bitmap& bitmap);
+	int		allocate(int width, int height, int& x, int& y);	// Page of the area, -1 when it can't fit
+	void	evict(size_t page);
+	void	grow(void);
+	void	setTextureCoordinates(Glyph& glyph) const;
+	void	markDirty(int x, int y, int width, int height);
+private:
+	TTF_Font									*_pFont;
+	ExoRenderer::ThreadPool						*_pWorker;	// A single thread, the face isn't shared
+
+	mutable std::mutex							_mutex;
+	mutable std::vector<Bitmap>					_rasterised;	// Guarded by _mutex
+
+	mutable std::unordered_map<uint32_t, Glyph>	_glyphs;
+	mutable std::vector<Page>					_pages;
+	std::vector<unsigned char>					_pixels;	// Copy of the atlas
+	int											_height;	// Of the atlas texture
+	int											_dirty[4];	// Left, top, right, bottom not uploaded yet
+	unsigned int								_generation;
+	unsigned long								_frame;		// CommandBuffer::getFrame of the last update
+
+	static std::mutex							_faceMutex;	// Opening and closing faces touch the shared FreeType library
+};
+
+}
@@ -0,0 +1,56 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "RenderStats.h"
+
+namespace	ExoRendererSDLOpenGL
+{
+
+// Counters of the frame being executed, only touched from the GL thread.
+// Texture uploads can come from loader threads and are folded in at present.
+class FrameStats
+{
+public:
+	static void	draw(uint32_t triangles, uint32_t instances = 1)
+	{
+		current.drawCalls++;
+		current.instances += instances;
+		current.triangles += triangles;
+	}
+
+	static void	uploadTexture(uint64_t bytes)
+	{
+		textureBytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+public:
+	static ExoRenderer::RenderStats	current;
+	static std::atomic<uint64_t>	textureBytes;
+};
+
+}
@@ -0,0 +1,77 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+
+#include "MemoryReport.h"
+
+namespace	ExoRendererSDLOpenGL
+{
+
+class Texture;
+
+// Allocated GPU memory per category, updated from any thread. Over budget, textures
+// loaded from a file which weren't bound for a while are evicted least recently used
+// first, they draw the placeholder and load again in the background on their next use.
+class GPUMemory
+{
+public:
+	static void		allocate(ExoRenderer::MemoryCategory category, uint64_t bytes);
+	static void		release(ExoRenderer::MemoryCategory category, uint64_t bytes);
+	static void		reload(void);	// Counts an evicted texture loading again
+
+	// Textures which can be evicted, from their constructor and destructor
+	static void		track(Texture *texture);
+	static void		untrack(Texture *texture);
+
+	// GL thread, once the frame is presented
+	static void		endFrame(void);
+
+	// Getters
+	static uint64_t	getFrame(void);
+	static ExoRenderer::MemoryReport	getReport(void);
+	// With the mip chain generated from it
+	static uint64_t	getSize(uint64_t baseLevel, bool mipmapped);
+
+	// Setters
+	static void		setBudget(uint64_t bytes, unsigned int idleFrames);
+private:
+	static std::atomic<uint64_t>		_bytes[ExoRenderer::MEMORY_CATEGORY_MAX];
+	static std::atomic<uint64_t>		_frame;
+	static std::atomic<uint64_t>		_reloads;
+
+	static std::mutex					_mutex;	// Guards the textures, the budget and the counters below
+	static std::unordered_set<Texture*>	_textures;
+	static uint64_t						_budget;
+	static unsigned int					_idleFrames;
+	static uint64_t						_evictions;
+	static uint64_t						_overBudgetFrames;
+};
+
+}
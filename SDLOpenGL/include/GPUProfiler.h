@@ -0,0 +1,108 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "GPUPass.h"
+#include "OGLCall.h"
+
+// Frames between a query and its readback, the pipeline never waits on a result
+#define GPU_PROFILER_LATENCY	4
+// Frames in the rolling average
+#define GPU_PROFILER_HISTORY	60
+
+namespace	ExoRendererSDLOpenGL
+{
+
+// Timestamp queries around render passes, called from the GL thread only
+// (except getPasses). Passes are also pushed as KHR_debug groups so capture
+// tools show the same names.
+class GPUProfiler
+{
+public:
+	GPUProfiler(void);
+	~GPUProfiler(void);
+
+	void	push(const char *name);
+	void	pop(void);
+	void	endFrame(void);
+
+	void	release(void);
+
+	// Getters
+	bool								isEnabled(void) const;
+	std::vector<ExoRenderer::GPUPass>	getPasses(void);
+
+	// Setters
+	void	setEnabled(bool enabled);
+private:
+	struct Marker
+	{
+		const char		*name;
+		unsigned int	depth;
+		GLuint			begin;
+		GLuint			end;
+	};
+
+	struct Frame
+	{
+		std::vector<GLuint>	queries;
+		unsigned int		used;
+		std::vector<Marker>	markers;
+		bool				pending;
+	};
+
+	struct Node
+	{
+		std::string			name;
+		float				frameTime;
+		bool				touched;
+		float				last;
+		float				history[GPU_PROFILER_HISTORY];
+		unsigned int		samples;
+		unsigned int		next;
+		std::vector<Node>	children;
+	};
+
+	GLuint		query(Frame &frame);
+	void		resolve(Frame &frame);
+
+	static Node	&findChild(std::vector<Node> &nodes, const char *name);
+	static void	commit(std::vector<Node> &nodes);
+	static void	exportPasses(const std::vector<Node> &nodes, std::vector<ExoRenderer::GPUPass> &passes);
+private:
+	bool						_enabled;
+	Frame						_frames[GPU_PROFILER_LATENCY];
+	unsigned int				_frameIndex;
+	std::vector<unsigned int>	_stack;
+
+	std::mutex					_mutex;
+	std::vector<Node>			_passes;
+};
+
+}
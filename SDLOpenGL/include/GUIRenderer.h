@@ -29,6 +29,7 @@
 
 #include "Shader.h"
 #include "Buffer.h"
+#include "CommandBuffer.h"
 
 #include "TextRenderer.h"
 #include "IWidget.h"
@@ -52,21 +53,24 @@ public:
 
 	void add(ExoRenderer::IWidget* widget);
 	void remove(ExoRenderer::IWidget* widget);
-	void render(const glm::mat4& orthographic);
+	void record(CommandBuffer& commands, const glm::mat4& orthographic);
+	void execute(const RenderCommand& command, const CommandBuffer& commands);
 private:
-	void prepare(const glm::mat4& orthographic);
+	void prepare(CommandBuffer& commands);
 private:
-	unsigned char render(ExoRenderer::IWidget* widget, Shader* shader);
-	unsigned char render(ExoRenderer::Button* button, Shader* shader);
-	unsigned char render(ExoRenderer::Checkbox* checkbox, Shader* shader);
-	unsigned char render(ExoRenderer::Select* select, Shader* shader);
-	unsigned char render(ExoRenderer::Input* input, Shader* shader);
-	unsigned char render(ExoRenderer::Image* image, Shader* shader);
-	unsigned char render(ExoRenderer::Spinner* spinner, Shader* shader);
-	unsigned char render(ExoRenderer::View* view, Shader* shader);
-	unsigned char render(ExoRenderer::Slider* slider, Shader* shader);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::IWidget* widget);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Button* button);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Checkbox* checkbox);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Select* select);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Input* input);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Image* image);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Spinner* spinner);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::View* view);
+	unsigned char record(CommandBuffer& commands, ExoRenderer::Slider* slider);
 
-	static void drawSliced(Shader* shader, unsigned int offsetX, unsigned int offsetY, float positionX, float positionY, float sizeX, float sizeY, bool isHoverOffset, unsigned int numberOfRows, unsigned int numberOfColumns);
+	void drawQuad(CommandBuffer& commands, const std::shared_ptr<ExoRenderer::ITexture>& texture, const glm::mat4& transformation);
+	void drawSliced(CommandBuffer& commands, const std::shared_ptr<ExoRenderer::ITexture>& texture, unsigned int offsetX, unsigned int offsetY, float positionX, float positionY, float sizeX, float sizeY, bool isHoverOffset, unsigned int numberOfRows, unsigned int numberOfColumns);
+	static void renderQuad(const RenderCommand& command, const CommandBuffer& commands);
 public:
 	static Shader* pGuiShader;
 private:
@@ -74,8 +78,20 @@ private:
 	std::deque<ExoRenderer::IWidget*> _renderFrontQueue;
 
 	glm::mat4 _orthographic;
+	unsigned int _projection;
+
+	// Uniforms of the GUI shader, they persist from one draw to the next
+	float _opacity;
+	float _numberOfRows;
+	float _numberOfColumns;
+	glm::vec2 _offset;
+
 	Buffer* _vaoBuffer;
 	Buffer* _vertexBuffer;
+
+	// The labels of each View, in the order they are recorded. Kept from one frame to the next with their batches.
+	std::deque<TextRenderer> _viewTextRenderers;
+	size_t _views;
 };
 
 }
@@ -31,6 +31,7 @@
 #include "Buffer.h"
 #include "sprite.h"
 #include "Grid.h"
+#include "CommandBuffer.h"
 
 #include "Axis.h"
 
@@ -45,13 +46,15 @@ public:
 
 	void add(const ExoRenderer::sprite &s);
 	void remove(const ExoRenderer::sprite &s);
-	void render(Camera* camera, const glm::mat4& perspective);
+	void record(CommandBuffer& commands, Camera* camera, const glm::mat4& perspective);
+	static void execute(const RenderCommand& command, const CommandBuffer& commands);
 
 	// Setters
 	void setGrid(bool val);
 private:
-	void prepare(Camera* camera, const glm::mat4& perspective);
-	static void renderObject(ExoRenderer::sprite& s, Shader* shader);
+	static void prepare(const glm::mat4& perspective, const glm::mat4& view);
+	static bool isVisible(const glm::vec4 planes[6], const ExoRenderer::sprite& s);
+	static void renderObject(const RenderCommand& command, const CommandBuffer& commands, Shader* shader);
 public:
 	static Shader* pShader;
 	static Buffer* vaoBuffer;
@@ -0,0 +1,92 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+
+#include "CommandBuffer.h"
+
+namespace	ExoRendererSDLOpenGL
+{
+
+class Window;
+
+// Owns the GL context and replays (and presents) the frames recorded by the game thread.
+// The game thread records frame N + 1 while frame N is executed here, there
+// is never more than one frame in flight.
+class RenderThread
+{
+public:
+	typedef std::function<void(const CommandBuffer &)>	Executor;
+
+	RenderThread(Window *window, const Executor &executor);
+	~RenderThread(void);
+
+	CommandBuffer	&getRecordBuffer(void);
+
+	void			submit(void);
+	void			finish(void);
+
+	// Run a job with the GL context: inline when called from the GL thread or
+	// when no render thread is running, otherwise on the render thread.
+	static void		invoke(const std::function<void(void)> &job);
+
+	// Release a GL object once every recorded frame that may use it is executed,
+	// inline only when no render thread is running
+	static void		post(const std::function<void(void)> &job);
+	static bool		isActive(void);
+private:
+	void			run(void);
+	bool			hasWork(void) const;
+	void			runJobs(std::unique_lock<std::mutex> &lock);
+	static void		runReleases(std::vector<std::function<void(void)>> &releases);
+private:
+	Window					*_pWindow;
+	Executor				_executor;
+
+	std::thread				_thread;
+	std::mutex				_mutex;
+	std::condition_variable	_condition;
+	std::condition_variable	_frameDone;
+
+	CommandBuffer			_buffers[2];
+	int						_recordIndex;
+	bool					_framePending;
+	bool					_running;
+
+	std::deque<std::function<void(void)>>	_jobs;
+	std::vector<std::function<void(void)>>	_releases[2];
+	unsigned long			_jobsQueued;
+	unsigned long			_jobsDone;
+
+	static RenderThread		*_pInstance;
+};
+
+}
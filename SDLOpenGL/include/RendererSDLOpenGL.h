@@ -26,6 +26,7 @@
 
 #include <string>
 #include <thread>
+#include <mutex>
 #include <glm/mat4x4.hpp>
 
 #include "IRenderer.h"
@@ -43,6 +44,13 @@
 #include "Shader.h"
 #include "Texture.h"
 #include "ArrayTexture.h"
+#include "TextureAtlas.h"
+#include "TextureLoader.h"
+#include "CommandBuffer.h"
+#include "RenderThread.h"
+#include "GPUProfiler.h"
+#include "FrameStats.h"
+#include "GPUMemory.h"
 
 #include <vector>
 
@@ -65,7 +73,10 @@ public:
 	virtual ExoRenderer::IAxis			*createAxis(void);
 	virtual ExoRenderer::ITexture		*createTexture(const std::string& filePath, ExoRenderer::TextureFilter filter = ExoRenderer::TextureFilter::LINEAR);
 	virtual ExoRenderer::ITexture		*createTexture(unsigned int width, unsigned int height, ExoRenderer::TextureFormat format = ExoRenderer::TextureFormat::RGBA, ExoRenderer::TextureFilter filter = ExoRenderer::TextureFilter::LINEAR);
+	virtual ExoRenderer::ITexture		*createTextureAsync(const std::string& filePath, ExoRenderer::TextureFilter filter = ExoRenderer::TextureFilter::LINEAR);
 	virtual ExoRenderer::IArrayTexture	*createArrayTexture(int width, int height, std::vector<std::string> &textures, ExoRenderer::TextureFilter filter = ExoRenderer::TextureFilter::LINEAR);
+	virtual ExoRenderer::ITextureAtlas	*createTextureAtlas(int pageSize = TEXTURE_ATLAS_PAGE_SIZE, int padding = TEXTURE_ATLAS_PADDING, ExoRenderer::TextureFilter filter = ExoRenderer::TextureFilter::LINEAR);
+	virtual ExoRenderer::Font			*createDynamicFont(const std::string& filePath, unsigned int size);
 
 	virtual ExoRenderer::ICursor		 *createCursor();
 	virtual ExoRenderer::ILabel			*createLabel();
@@ -96,8 +107,8 @@ public:
 	virtual void draw(void);
 	virtual void swap(void);
 
-	void beginScissor(glm::vec2 position, glm::vec2 size, glm::vec2 parentPosition, glm::vec2 parentSize);
-	void endScissor(void);
+	void beginScissor(CommandBuffer& commands, glm::vec2 position, glm::vec2 size, glm::vec2 parentPosition, glm::vec2 parentSize);
+	void endScissor(CommandBuffer& commands);
 
 	// Getters
 	virtual ExoRenderer::IWindow *getWindow(void);
@@ -106,18 +117,33 @@ public:
 	virtual ExoRenderer::IMouse *getMouse(void);
 	virtual ExoRenderer::IGamepadManager *getGamepadManager(void);
 	virtual unsigned int getTime(void) const;
+	virtual bool isRenderThreadEnabled(void) const;
+	virtual bool isGPUProfilingEnabled(void) const;
+	virtual std::vector<ExoRenderer::GPUPass> getGPUPasses(void);
+	virtual ExoRenderer::RenderStats getStats(void);
+	virtual ExoRenderer::RenderStatsHistory getStatsHistory(void);
+	virtual void readFrame(std::vector<unsigned char> &pixels);
+	virtual ExoRenderer::MemoryReport getMemoryReport(void);
 
 	// Setters
 	virtual void setCursor(ExoRenderer::ICursor* cursor);
 	virtual void setMousePicker(ExoRenderer::MousePicker* picker);
 	virtual void setAxis(ExoRenderer::IAxis* axis);
 	virtual void setGridEnable(bool val);
+	virtual void setRenderThread(bool enabled);
+	virtual void setGPUProfiling(bool enabled);
+	virtual void setTextureUploadBudget(size_t bytes);
+	virtual void setMemoryBudget(uint64_t bytes, unsigned int idleFrames = MEMORY_IDLE_FRAMES);
 private:
 	RendererSDLOpenGL(void);
 	virtual ~RendererSDLOpenGL(void);
 
 	void createBuffers(void);
 	void loadShaders(void);
+
+	void record(CommandBuffer& commands);
+	void execute(const CommandBuffer& commands);
+	void present(void);
 private:
 	Window* _pWindow;
 
@@ -131,6 +157,18 @@ private:
 
 	glm::mat4 _perspective, _orthographic;
 	int _scissorBit[4];
+	int _scissorBox[4];
+
+	CommandBuffer _commands;
+	RenderThread* _pRenderThread;
+	GPUProfiler _gpuProfiler;
+	TextureLoader* _pTextureLoader;
+	bool _frameCleared;
+	unsigned long _recordedFrames;
+
+	std::mutex _statsMutex;
+	ExoRenderer::RenderStats _stats;
+	ExoRenderer::RenderStatsHistory _statsHistory;
 
 	std::thread::id _mainThread;
 	Cursor* _pCursor;
@@ -0,0 +1,91 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include "Enums.h"
+#include "OGLCall.h"
+
+// Texture units whose bound sampler is remembered, binds past it always go through
+#define SAMPLER_CACHE_UNITS	16
+
+namespace	ExoRendererSDLOpenGL
+{
+
+// Everything sampling reads besides the texels
+struct SamplerState
+{
+	ExoRenderer::TextureFilter	filter;
+	GLenum						wrap;		// GL_REPEAT, GL_CLAMP_TO_EDGE, ...
+	float						lodBias;
+	float						minLod;
+	float						maxLod;
+
+	bool	operator==(const SamplerState &other) const;
+};
+
+// One sampler object per distinct state, shared by the textures using it.
+// Textures are registered by GL id: binding one binds its sampler to the same unit,
+// an unregistered texture samples with its own parameters.
+// Textures created on another context register themselves concurrently with the binds,
+// the registry is locked; their creation fence publishes the samplers they create.
+// Without sampler objects (GL 3.3, ARB_sampler_objects) the state is set on the texture.
+class SamplerCache
+{
+public:
+	// The state of a texture, which must be bound to target when sampler objects are missing
+	static void		apply(GLuint texture, GLenum target, const SamplerState &state);
+	// Before the texture is deleted, its id may be reused
+	static void		remove(GLuint texture);
+
+	// The texture's sampler, or none, to the unit
+	static void		bind(GLuint texture, int unit = 0);
+	// Deletes the samplers, before the context
+	static void		clear(void);
+
+	// Getters
+	static GLuint	getSampler(const SamplerState &state);	// Created on first use
+	static size_t	getCount(void);
+	static bool		isSupported(void);
+private:
+	static void		applyParameters(GLenum target, const SamplerState &state);
+private:
+	struct Entry
+	{
+		SamplerState	state;
+		GLuint			sampler;
+	};
+
+	static std::vector<Entry>					_samplers;	// A handful, searched linearly
+	static std::unordered_map<GLuint, GLuint>	_textures;	// Texture to sampler
+	static GLuint								_bound[SAMPLER_CACHE_UNITS];
+	static std::mutex							_mutex;
+};
+
+}
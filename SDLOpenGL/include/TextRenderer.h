@@ -24,13 +24,19 @@
 
 #pragma once
 
-#include <deque>
-#include <cwchar>
+#include <vector>
+#include <string>
 
 #include "Shader.h"
 #include "Label.h"
 #include "Font.h"
 #include "Buffer.h"
+#include "CommandBuffer.h"
+
+// Position, texture coordinates then color of a glyph vertex
+#define TEXT_VERTEX_FLOATS	7
+// Two triangles
+#define TEXT_GLYPH_FLOATS	(6 * TEXT_VERTEX_FLOATS)
 
 namespace	ExoRendererSDLOpenGL
 {
@@ -43,18 +49,33 @@ public:
 
 	void add(ExoRenderer::Label *element);
 	void remove(ExoRenderer::Label *element);
-	void render(const glm::mat4& orthographic);
+	void clear(void);
+	void record(CommandBuffer& commands, const glm::mat4& orthographic);
+	static void execute(const RenderCommand& command, const CommandBuffer& commands);
 private:
-	void prepare(const glm::mat4& orthographic);
-	static void renderCharacter(const wchar_t c, float& x, float& y, ExoRenderer::Label* label);
-	static std::wstring utf8ToUtf16(const std::string& utf8Str);
+	// The glyphs of every label using a font
+	struct Batch
+	{
+		ExoRenderer::Font		*font;		// Only read while a label uses it
+		GLuint					texture;
+		std::vector<float>		vertices;	// Capacity kept from one frame to the next
+		bool					recorded;	// Used this frame
+	};
+
+	Batch &getBatch(CommandBuffer& commands, ExoRenderer::Font* font);
+	// Laid out again only once invalidated
+	static ExoRenderer::Label::GlyphCache &getGlyphCache(ExoRenderer::Label* label);
+
+	static void prepare(const glm::mat4& orthographic);
+	static void recordCharacter(std::vector<float>& vertices, const char32_t c, const char32_t previous, float& x, float y, ExoRenderer::Label* label, const glm::vec3& color);	// Relative to the label
+	static void renderText(const RenderCommand& command, const CommandBuffer& commands);
 public:
 	static Shader* pTextShader;
 	static Buffer* vaoBuffer;
 	static Buffer* vertexBuffer;
 private:
-	std::deque<ExoRenderer::Label*> _renderQueue;
-	int _currentTextureBind;
+	std::vector<ExoRenderer::Label*> _renderQueue;	// Cleared without releasing its capacity, unlike a deque
+	std::vector<Batch> _batches;
 };
 
 }
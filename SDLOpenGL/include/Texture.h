@@ -25,18 +25,27 @@
 #pragma once
 
 #include <SDL2/SDL_image.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
 
 #include "Enums.h"
 #include "ITexture.h"
 #include "OGLCall.h"
 
+// Upper bound of the ANISOTROPIC filter, further clamped to the driver maximum
+#define TEXTURE_MAX_ANISOTROPY	8.0f
+
 namespace	ExoRendererSDLOpenGL
 {
 
+struct TextureRequest;
+
 class Texture: public ExoRenderer::ITexture
 {
 	public:
-		Texture(unsigned int width, unsigned int height, ExoRenderer::TextureFormat format, ExoRenderer::TextureFilter filter);
+		Texture(unsigned int width, unsigned int height, ExoRenderer::TextureFormat format, ExoRenderer::TextureFilter filter, GLenum wrap = GL_REPEAT);
 		Texture(const std::string& filePath, ExoRenderer::TextureFilter filter);
 		virtual ~Texture(void);
 
@@ -45,21 +54,65 @@ class Texture: public ExoRenderer::ITexture
 
 		// Getters
 		virtual int		getEngineId(void) const;
-		GLuint			getBuffer(void) const;
+		GLuint			getBuffer(void) const;	// The placeholder until resident
 		ExoRenderer::TextureFormat	getFormat(void) const;
+		virtual bool	isResident(void) const;
+		virtual uint64_t	getAllocatedBytes(void) const;
+
+		// Setters
+		virtual void	setLodBias(float bias);
+		virtual void	setLodRange(float minLod, float maxLod);
+		void			setCategory(ExoRenderer::MemoryCategory category);	// GL thread
 
 		// Static
 		static SDL_Surface*	generateDefaultTexture();
 		static GLenum		getFormat(const unsigned int& format);
+		static void			bindBuffer(GLuint id, int unit = 0);
+		static void			resetBinding(void);	// After binding a texture without bindBuffer
+		static void			applyFilter(const ExoRenderer::TextureFilter& filter, GLenum target = GL_TEXTURE_2D);
+		static bool			isMipmapped(const ExoRenderer::TextureFilter& filter);
+		static GLint		getMinFilter(const ExoRenderer::TextureFilter& filter);
+		static GLint		getMagFilter(const ExoRenderer::TextureFilter& filter);
+		static float		getAnisotropy(void);	// Of the ANISOTROPIC filter, 1 when unsupported
+
+		// Levels of the bound texture: immutable (glTexStorage) where supported, every level
+		// allocated through glTexImage otherwise. Filled with glTexSubImage, uncompressed formats only.
+		static void			allocateStorage(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei layers = 1);
+		static bool			hasImmutableStorage(void);
+		static GLsizei		getLevelCount(GLsizei width, GLsizei height);	// Down to 1x1
+		static GLenum		getInternalFormat(GLenum format);	// Sized, of a getFormat() result
 
 		virtual int getWidth(void) const;
 		virtual int getHeight(void) const;
+
+		static GLuint	placeholderId;
 	private:
-		static void		applyFilter(const ExoRenderer::TextureFilter& filter);
+		friend class TextureLoader;
+		friend class GPUMemory;
+
+		// Loaded by the TextureLoader
+		Texture(const std::shared_ptr<TextureRequest> &request);
+
+		bool			loadContainer(const std::string& filePath, ExoRenderer::TextureFilter filter);
+		void			applySampler(void) const;
+		void			setAllocated(uint64_t bytes);
+		uint64_t		evict(void);	// GL thread, returns the bytes released
 		GLuint			_id;
 		ExoRenderer::TextureFormat	_format;
 		int				_width;
 		int				_height;
+		GLenum			_wrap;
+		float			_lodBias, _minLod, _maxLod;	// GL thread only
+		std::atomic<bool>				_resident;
+		std::shared_ptr<TextureRequest>	_pRequest;
+
+		// Loaded again from there once evicted, empty for render targets
+		std::string						_filePath;
+		ExoRenderer::TextureFilter		_filter;
+		ExoRenderer::MemoryCategory		_category;
+		std::atomic<uint64_t>			_bytes;		// Accounted to GPUMemory
+		mutable std::atomic<uint64_t>	_lastUsed;	// GPUMemory frame
+		mutable std::atomic<bool>		_evicted;
 };
 
 }
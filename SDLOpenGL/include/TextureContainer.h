@@ -0,0 +1,129 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "OGLCall.h"
+#include "MappedFile.h"
+
+// Renderer texture files (.etex), little endian:
+// a 40 bytes header (magic, version, internal format, pixel format, pixel type,
+// width, height, layers, levels, reserved), a table of 64-bit offset and size pairs,
+// one per level, then every level aligned to TEXTURE_FILE_ALIGNMENT with its layers
+// one after the other, exactly as glTexImage3D and glCompressedTexImage3D read them
+#define TEXTURE_FILE_MAGIC		0x58455445	// "ETEX"
+#define TEXTURE_FILE_VERSION	1
+#define TEXTURE_FILE_ALIGNMENT	16
+
+namespace	ExoRendererSDLOpenGL
+{
+
+// Texture files (.etex, KTX, KTX2, DDS) with every layer and mip level,
+// stored level by level with the layers of a level one after the other.
+// BCn, ETC2 and ASTC blocks are kept as is, 8-bit RGBA and RGB are the uncompressed layouts.
+// Files are mapped and their levels uploaded from the mapping when the layout allows it.
+class TextureContainer
+{
+public:
+	TextureContainer(void);
+	~TextureContainer(void);
+
+	TextureContainer(const TextureContainer &) = delete;
+	TextureContainer	&operator=(const TextureContainer &) = delete;
+
+	// Throws std::runtime_error on unreadable, malformed or unsupported files
+	void	load(const std::string &filePath);
+	void	load(const unsigned char *data, size_t size);	// Copied
+
+	// A single layer and level of 8-bit pixels, rows are pitch bytes apart
+	void	setImage(GLenum internalFormat, GLenum pixelFormat, unsigned int width, unsigned int height, const unsigned char *pixels, size_t pitch);
+	// Box filtered levels down to 1x1, uncompressed single level containers only
+	void	generateMipmaps(void);
+	// The next level of one layer: 2x2 average, the last row or column is repeated on odd sizes
+	static void	downsample(const unsigned char *source, unsigned int sourceWidth, unsigned int sourceHeight, unsigned int channels, unsigned char *destination);
+	// As an .etex file, throws std::runtime_error
+	void	save(const std::string &filePath) const;
+
+	// Layers of another container with the same format, size and levels
+	void	appendLayers(const TextureContainer &other);
+
+	// RGBA8 on the CPU, only BC1 - BC5 (unsigned) can be decoded, false otherwise
+	bool	decompress(void);
+
+	// Every level to the bound GL_TEXTURE_2D (first layer) or GL_TEXTURE_2D_ARRAY,
+	// decompressed first when the driver lacks the format. A single uncompressed
+	// level gets the rest of its chain generated on request. Returns the bytes uploaded.
+	size_t	upload(GLenum target, bool generateMipmaps = false);
+	// Of every level and layer once uploaded, the generated levels included
+	size_t	getAllocatedSize(bool generateMipmaps = false) const;
+
+	// Getters
+	GLenum			getFormat(void) const;
+	GLenum			getPixelFormat(void) const;	// Uncompressed layouts only
+	bool			isCompressed(void) const;
+	unsigned int	getWidth(void) const;
+	unsigned int	getHeight(void) const;
+	unsigned int	getLayers(void) const;
+	unsigned int	getLevels(void) const;
+	size_t			getLevelSize(unsigned int level) const;	// Of one layer
+	const unsigned char	*getLevel(unsigned int level) const;	// Every layer
+	bool			isMapped(void) const;
+
+	// By extension: .etex, .ktx, .ktx2 or .dds
+	static bool		isContainer(const std::string &filePath);
+	// Whether the driver samples the format directly, once GLEW is initialized
+	static bool		isFormatSupported(GLenum format);
+private:
+	void	parse(const unsigned char *data, size_t size);
+	void	own(void);
+	void	loadETEX(const unsigned char *data, size_t size);
+	void	loadKTX(const unsigned char *data, size_t size);
+	void	loadKTX2(const unsigned char *data, size_t size);
+	void	loadDDS(const unsigned char *data, size_t size);
+	void	setFormat(GLenum format);
+	void	checkHeader(uint32_t levels, const char *container) const;
+	void	setLevel(unsigned int level, unsigned int layer, const unsigned char *data);
+private:
+	GLenum			_format;		// Internal format
+	GLenum			_pixelFormat;
+	bool			_compressed;
+	unsigned int	_blockWidth;
+	unsigned int	_blockHeight;
+	unsigned int	_blockBytes;
+
+	unsigned int	_width;
+	unsigned int	_height;
+	unsigned int	_layers;
+
+	// Views into the mapped file, or into _storage once copied or decoded
+	std::vector<const unsigned char*>				_levels;
+	std::vector<std::vector<unsigned char>>			_storage;
+	std::shared_ptr<ExoRenderer::MappedFile>		_pFile;
+};
+
+}
@@ -0,0 +1,100 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "ThreadPool.h"
+#include "Texture.h"
+#include "TextureContainer.h"
+
+// Bytes uploaded per frame by default, a larger texture still goes through alone
+#define TEXTURE_UPLOAD_BUDGET	(4 * 1024 * 1024)
+// Pixel buffers cycled through, so an upload never waits on the previous one
+#define TEXTURE_UPLOAD_BUFFERS	3
+
+namespace	ExoRendererSDLOpenGL
+{
+
+// One asynchronous load, shared by the texture, the decoding worker and the upload
+struct TextureRequest
+{
+	std::mutex					mutex;
+	Texture						*texture;	// nullptr once deleted, guarded by mutex
+	std::string					filePath;
+	ExoRenderer::TextureFilter	filter;
+	SDL_Surface					*surface;	// RGBA32, decoded by a worker
+	TextureContainer			*container;	// Or a KTX, KTX2 or DDS file, parsed by a worker
+};
+
+// Decodes image files on a ThreadPool and uploads them through pixel buffer
+// objects from the GL thread, a few per frame, see upload().
+// Texture containers are uploaded level by level straight from memory.
+class TextureLoader
+{
+public:
+	TextureLoader(void);
+	~TextureLoader(void);
+
+	// Any thread, the texture binds Texture::placeholderId until resident
+	Texture	*load(const std::string &filePath, ExoRenderer::TextureFilter filter);
+	// An evicted texture from its file, false without a loader
+	static bool	reload(Texture *texture);
+
+	// GL thread, once per frame
+	void	upload(void);
+
+	// Getters
+	size_t	getBudget(void) const;
+	size_t	getPendingCount(void);
+	ExoRenderer::ThreadPool	*getWorkers(void) const;
+
+	// Setters
+	void	setBudget(size_t bytes);
+private:
+	void	queue(const std::shared_ptr<TextureRequest> &request);
+	void	decode(const std::shared_ptr<TextureRequest> &request);
+	size_t	upload(TextureRequest &request);
+	size_t	uploadContainer(TextureRequest &request);
+
+	static size_t	getSize(const TextureRequest &request);
+private:
+	std::mutex									_mutex;
+	std::deque<std::shared_ptr<TextureRequest>>	_decoded;
+	size_t										_pending;	// Queued or being decoded
+	size_t										_budget;
+
+	GLuint										_pixelBuffers[TEXTURE_UPLOAD_BUFFERS];
+	unsigned int								_nextBuffer;
+
+	ExoRenderer::ThreadPool						*_pWorkers;
+
+	static TextureLoader						*_pInstance;
+};
+
+}
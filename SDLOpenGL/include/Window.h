@@ -27,6 +27,11 @@
 #include "OGLCall.h"
 #include <SDL2/SDL.h>
 #include <string>
+#include <vector>
+
+#ifndef __APPLE__
+# include <EGL/egl.h>
+#endif
 
 #include "IWindow.h"
 
@@ -49,9 +54,17 @@ public:
 	~Window(void);
 
 	void handleEvents(Keyboard& keyboard, Mouse& mouse, GamepadManager& gamepad);
+	void updateDelta(void);
 	void clearScreen(void);
+	void postProcess(void);
 	void swap(void);
 
+	void makeContextCurrent(void);
+	void releaseContext(void);
+
+	// RGBA8 rows of the offscreen target, top row first
+	void readPixels(std::vector<unsigned char> &pixels);
+
 	// Setters
 	virtual void setWindowSize(int w, int h);
 	virtual void setWindowMode(const ExoRenderer::WindowMode &mode);
@@ -70,11 +83,15 @@ public:
 
 	virtual int getHighDPIFactor(void) const;
 	virtual bool isFullscreen(void) const;
+	virtual bool isHeadless(void) const;
 
 	virtual bool getIsClosing(void) const;
 	Texture		 *_frameTexture;
 private:
 	void initialize(const std::string& title, uint32_t width, uint32_t height, const ExoRenderer::WindowMode &mode, bool resizable, GamepadManager& gamepad);
+	void initializeWindow(const std::string& title, uint32_t width, uint32_t height, bool resizable);
+	void initializeHeadless(void);
+	void releaseHeadless(void);
 	void initPostProcessing(void);
 private:
 	SDL_Window*	 _window;
@@ -82,6 +99,15 @@ private:
 	SDL_GLContext	_context;
 	SDL_GLContext	_threadContext;
 
+#ifndef __APPLE__
+	// Headless
+	EGLDisplay		_eglDisplay;
+	EGLContext		_eglContext;
+	EGLContext		_eglThreadContext;
+	EGLSurface		_eglSurface;
+	EGLSurface		_eglThreadSurface;
+#endif
+
 	// Post Processing
 	FrameBuffer	 *_pFrameBuffer;
 
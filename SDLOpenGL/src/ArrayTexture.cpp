@@ -24,83 +24,160 @@
 
 #include "ArrayTexture.h"
 #include "Texture.h"
+#include "RenderThread.h"
+#include "Profiler.h"
+#include "FrameStats.h"
+#include "GPUMemory.h"
+#include "TextureContainer.h"
+#include "SamplerCache.h"
 #include <stdexcept>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <algorithm>
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
 
+namespace
+{
+
+// Layers decoded by the workers, shared so a failed upload can return before them
+struct DecodedLayers
+{
+	std::mutex									mutex;
+	std::condition_variable						condition;
+	std::deque<std::pair<int, SDL_Surface*>>	layers;
+	std::string									error;
+};
+
+}
+
 ArrayTexture::ArrayTexture()
+: _pWorkers(nullptr), _id(0), _format(GL_RGBA8), _filter(LINEAR), _width(0), _height(0), _layers(0), _capacity(0), _levels(0), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f), _bytes(0)
 {	}
 
-ArrayTexture::ArrayTexture(int width, int height, std::vector<std::string>& textures, TextureFilter filter)
+ArrayTexture::ArrayTexture(int width, int height, std::vector<std::string>& textures, TextureFilter filter, ThreadPool *workers)
+: _pWorkers(workers), _id(0), _format(GL_RGBA8), _filter(filter), _width(0), _height(0), _layers(0), _capacity(0), _levels(0), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f), _bytes(0)
 {
 	initialize(width, height, textures, filter);
 }
 
 ArrayTexture::~ArrayTexture(void)
 {
-	glDeleteTextures(1, &_id);
+	GLuint	id = _id;
+
+	GPUMemory::release(MEMORY_ARRAY_TEXTURES, _bytes);
+	RenderThread::post([id]() {
+		SamplerCache::remove(id);
+		glDeleteTextures(1, &id);
+	});
 }
 
 void ArrayTexture::initialize(int width, int height, std::vector<std::string>& textures, TextureFilter filter)
 {
+	EXO_PROFILE_ZONE("ArrayTexture::load");
+
 	if (textures.size() <= 0)
 		throw (std::invalid_argument("cannot create ArrayTexture, number of images insufficient."));
 
-	// Generate array texture (based on the fist image in the vector)
-	SDL_Surface* image = IMG_Load(textures[0].c_str());
-	if (!image)
+	_filter = filter;
+	_width = width;
+	_height = height;
+	_layers = (int)textures.size();
+	_capacity = _layers;
+	_levels = Texture::isMipmapped(filter) ? Texture::getLevelCount(width, height) : 1;
+	_format = GL_RGBA8;
+
+	if (TextureContainer::isContainer(textures[0]))
+	{
+		initializeContainer(width, height, textures, filter);
+		return ;
+	}
+
+	std::shared_ptr<DecodedLayers>	decoded = std::make_shared<DecodedLayers>();
+	std::string						error;
+
+	// Every layer is decoded concurrently and uploaded as soon as it is ready
+	for (int i = 0; i < (int)textures.size(); i++)
 	{
-		image = Texture::generateDefaultTexture();
-		SDL_FillRect(image, NULL, SDL_MapRGB(image->format, 255, 0, 255));
+		std::function<void(void)> job = [decoded, path = textures[i], i, width, height]() {
+			std::string		message;
+			SDL_Surface		*image = decodeLayer(path, width, height, message);
+
+			std::lock_guard<std::mutex> lock(decoded->mutex);
+			if (!image && decoded->error.empty())
+				decoded->error = message;
+			decoded->layers.emplace_back(i, image);
+			decoded->condition.notify_one();
+		};
+
+		if (_pWorkers)
+			_pWorkers->post(job);
+		else
+			job();
 	}
 
 	GL_CALL(glGenTextures(1, &_id));
 
-	GLenum textureFormat = Texture::getFormat(image->format->BytesPerPixel);
 	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
 
-	GL_CALL(glTexImage3D(GL_TEXTURE_2D_ARRAY,
-				0,
-				textureFormat,
-				width, height, (GLsizei)textures.size(),
-				0,
-				textureFormat,
-				GL_UNSIGNED_BYTE,
-				nullptr));
-
-	if (image)
-		SDL_FreeSurface(image);
+	Texture::allocateStorage(GL_TEXTURE_2D_ARRAY, _levels, GL_RGBA8, width, height, (GLsizei)textures.size());
+	setAllocated(GPUMemory::getSize((uint64_t)width * height * 4 * textures.size(), Texture::isMipmapped(filter)));
 
-	// Apply sub textures
-	for (int i = 0; i < (int)textures.size(); i++)
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+	for (size_t remaining = textures.size(); remaining > 0; remaining--)
 	{
-		image = IMG_Load(textures[i].c_str());
-		if (!image)
+		std::pair<int, SDL_Surface*>	layer;
+		bool							failed;
+
 		{
-			image = Texture::generateDefaultTexture();
-			SDL_FillRect(image, NULL, SDL_MapRGB(image->format, 255, 0, 255));
+			std::unique_lock<std::mutex> lock(decoded->mutex);
+
+			decoded->condition.wait(lock, [&decoded]() { return !decoded->layers.empty(); });
+			layer = decoded->layers.front();
+			decoded->layers.pop_front();
+			error = decoded->error;
+			failed = !error.empty();
 		}
 
-		GL_CALL(glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0,
-				0, 0, i,
-				width, height, 1,
-				Texture::getFormat(image->format->BytesPerPixel),
-				GL_UNSIGNED_BYTE,
-				image->pixels));
+		// Every layer is still waited for after an error, then released
+		if (!layer.second)
+			continue ;
+		if (!failed)
+		{
+			GL_CALL(glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0,
+					0, 0, layer.first,
+					width, height, 1,
+					GL_RGBA,
+					GL_UNSIGNED_BYTE,
+					layer.second->pixels));
+			FrameStats::uploadTexture((uint64_t)width * height * 4);
+		}
+		SDL_FreeSurface(layer.second);
+	}
 
-		if (image)
-			SDL_FreeSurface(image);
+	if (!error.empty())
+	{
+		GL_CALL(glDeleteTextures(1, &_id));
+		_id = 0;
+		setAllocated(0);
+		throw (std::invalid_argument("cannot create ArrayTexture, " + error));
 	}
 
-	// Filter
-	applyFilter(filter);
+	if (Texture::isMipmapped(filter))
+		GL_CALL(glGenerateMipmap(GL_TEXTURE_2D_ARRAY));
+
+	applySampler();
 }
 
 void ArrayTexture::bind(int unit) const
 {
 	GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
 	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
+	FrameStats::current.textureBinds++;
+	SamplerCache::bind(_id, unit);
 }
 
 void ArrayTexture::unbind(void) const
@@ -109,26 +186,255 @@ void ArrayTexture::unbind(void) const
 	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, 0));
 }
 
+// Setters
+void ArrayTexture::setLodBias(float bias)
+{
+	// Kept to be applied again when the array grows
+	RenderThread::invoke([this, bias]() {
+		_lodBias = bias;
+		GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
+		applySampler();
+	});
+}
+
+void ArrayTexture::setLodRange(float minLod, float maxLod)
+{
+	RenderThread::invoke([this, minLod, maxLod]() {
+		_minLod = minLod;
+		_maxLod = maxLod;
+		GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
+		applySampler();
+	});
+}
+
+int ArrayTexture::appendLayer(const std::string& filePath)
+{
+	SDL_Surface	*image = decodeLayer(filePath);
+	int			layer;
+
+	// Decoded on the calling thread, only the copy and upload need the context
+	RenderThread::invoke([this, image, &layer]() {
+		if (_layers == _capacity)
+			grow(std::max(_capacity * 2, 1));
+		layer = _layers++;
+		uploadLayer(layer, image);
+	});
+	return layer;
+}
+
+void ArrayTexture::replaceLayer(int layer, const std::string& filePath)
+{
+	SDL_Surface	*image;
+
+	if (layer < 0 || layer >= _layers)
+		throw (std::out_of_range("ArrayTexture has no layer " + std::to_string(layer)));
+
+	image = decodeLayer(filePath);
+	RenderThread::invoke([this, image, layer]() { uploadLayer(layer, image); });
+}
+
+void ArrayTexture::reserve(int capacity)
+{
+	if (_format != GL_RGBA8)
+		throw (std::logic_error("only RGBA8 ArrayTextures can change their layers"));
+
+	RenderThread::invoke([this, capacity]() {
+		if (capacity > _capacity)
+			grow(capacity);
+	});
+}
+
 // Getters
 unsigned int ArrayTexture::getBuffer(void) const
 {
 	return _id;
 }
 
+int ArrayTexture::getLayerCount(void) const
+{
+	return _layers;
+}
+
+int ArrayTexture::getCapacity(void) const
+{
+	return _capacity;
+}
+
+uint64_t ArrayTexture::getAllocatedBytes(void) const
+{
+	return _bytes.load(std::memory_order_relaxed);
+}
+
 // Private
-void ArrayTexture::applyFilter(const TextureFilter& filter)
+SDL_Surface *ArrayTexture::decodeLayer(const std::string &filePath, int width, int height, std::string &error)
 {
-	switch (filter)
+	EXO_PROFILE_ZONE("ArrayTexture::decodeLayer");
+
+	SDL_Surface	*image = IMG_Load(filePath.c_str());
+	SDL_Surface	*layer;
+
+	// A missing layer is magenta, like a missing texture
+	if (!image)
 	{
-		case TextureFilter::NEAREST:
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
-			break;
-		default:
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-			break;
+		layer = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+		if (layer)
+			SDL_FillRect(layer, NULL, SDL_MapRGB(layer->format, 255, 0, 255));
+		else
+			error = "cannot allocate a layer for " + filePath;
+		return layer;
 	}
+
+	if (image->w != width || image->h != height)
+	{
+		error = filePath + " is " + std::to_string(image->w) + "x" + std::to_string(image->h) + ", not " + std::to_string(width) + "x" + std::to_string(height);
+		SDL_FreeSurface(image);
+		return nullptr;
+	}
+
+	// One layout for every layer
+	layer = SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(image);
+	if (!layer)
+		error = "cannot convert " + filePath;
+	return layer;
+}
+
+SDL_Surface *ArrayTexture::decodeLayer(const std::string &filePath) const
+{
+	SDL_Surface	*image;
+	std::string	error;
+
+	if (_format != GL_RGBA8)
+		throw (std::logic_error("only RGBA8 ArrayTextures can change their layers"));
+
+	image = decodeLayer(filePath, _width, _height, error);
+	if (!image)
+		throw (std::invalid_argument("cannot add to ArrayTexture, " + error));
+	return image;
+}
+
+void ArrayTexture::uploadLayer(int layer, SDL_Surface *image)
+{
+	std::vector<unsigned char>	source, destination;
+	const unsigned char			*pixels = (const unsigned char *)image->pixels;
+
+	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+	GL_CALL(glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, _width, _height, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+	FrameStats::uploadTexture((uint64_t)_width * _height * 4);
+
+	// Only this layer's levels, glGenerateMipmap would rebuild every layer
+	for (int level = 1; level < _levels; level++)
+	{
+		int	width = std::max(_width >> level, 1);
+		int	height = std::max(_height >> level, 1);
+
+		destination.resize((size_t)width * height * 4);
+		TextureContainer::downsample(pixels, std::max(_width >> (level - 1), 1), std::max(_height >> (level - 1), 1), 4, destination.data());
+		GL_CALL(glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, destination.data()));
+		FrameStats::uploadTexture((uint64_t)width * height * 4);
+		source.swap(destination);
+		pixels = source.data();
+	}
+	SDL_FreeSurface(image);
+}
+
+void ArrayTexture::grow(int capacity)
+{
+	EXO_PROFILE_ZONE("ArrayTexture::grow");
+
+	GLuint	previous = _id;
+
+	GL_CALL(glGenTextures(1, &_id));
+	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
+	Texture::allocateStorage(GL_TEXTURE_2D_ARRAY, _levels, GL_RGBA8, _width, _height, capacity);
+	setAllocated(GPUMemory::getSize((uint64_t)_width * _height * 4 * capacity, Texture::isMipmapped(_filter)));
+	applySampler();
+
+	// The layers never leave the GPU, their levels are copied rather than generated again
+	if (GLEW_VERSION_4_3 || GLEW_ARB_copy_image)
+	{
+		for (int level = 0; level < _levels; level++)
+			GL_CALL(glCopyImageSubData(previous, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, _id, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+				std::max(_width >> level, 1), std::max(_height >> level, 1), _layers));
+	}
+	else
+		copyLayers(previous, _layers);
+	_capacity = capacity;
+
+	// Frames already recorded still sample the previous texture, the one in flight included
+	RenderThread::post([previous]() {
+		SamplerCache::remove(previous);
+		glDeleteTextures(1, &previous);
+	});
+}
+
+void ArrayTexture::setAllocated(uint64_t bytes)
+{
+	// The previous storage is released with it, grow() posts its deletion
+	GPUMemory::release(MEMORY_ARRAY_TEXTURES, _bytes);
+	GPUMemory::allocate(MEMORY_ARRAY_TEXTURES, bytes);
+	_bytes = bytes;
+}
+
+void ArrayTexture::copyLayers(GLuint source, int layers)
+{
+	GLuint	framebuffer;
+	GLint	readFramebuffer;
+
+	// Into the bound array, one layer and level at a time through a read framebuffer
+	GL_CALL(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer));
+	GL_CALL(glGenFramebuffers(1, &framebuffer));
+	GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer));
+	for (int level = 0; level < _levels; level++)
+	{
+		for (int layer = 0; layer < layers; layer++)
+		{
+			GL_CALL(glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, source, level, layer));
+			GL_CALL(glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, 0, 0, std::max(_width >> level, 1), std::max(_height >> level, 1)));
+		}
+	}
+	GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer));
+	GL_CALL(glDeleteFramebuffers(1, &framebuffer));
+}
+
+void ArrayTexture::applySampler(void) const
+{
+	// The array is bound
+	SamplerCache::apply(_id, GL_TEXTURE_2D_ARRAY, {_filter, GL_REPEAT, _lodBias, _minLod, _maxLod});
+}
+
+void ArrayTexture::initializeContainer(int width, int height, std::vector<std::string>& textures, TextureFilter filter)
+{
+	TextureContainer	container;
+
+	// One file holding every layer, or one file per layer
+	for (const std::string &path : textures)
+	{
+		TextureContainer	layers;
+
+		layers.load(path);
+		container.appendLayers(layers);
+	}
+
+	if ((int)container.getWidth() != width || (int)container.getHeight() != height)
+		throw (std::invalid_argument("cannot create ArrayTexture, layers are not " + std::to_string(width) + "x" + std::to_string(height)));
+	if (container.isCompressed() && !TextureContainer::isFormatSupported(container.getFormat()) && !container.decompress())
+		throw (std::runtime_error("cannot create ArrayTexture, the texture format is not supported by the driver"));
+
+	GL_CALL(glGenTextures(1, &_id));
+
+	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, _id));
+
+	FrameStats::uploadTexture(container.upload(GL_TEXTURE_2D_ARRAY, Texture::isMipmapped(filter)));
+	setAllocated(container.getAllocatedSize(Texture::isMipmapped(filter)));
+	_format = container.getFormat();
+	_layers = (int)container.getLayers();
+	_capacity = _layers;
+	// The generated chain, or the container's own levels
+	_levels = (Texture::isMipmapped(filter) && container.getLevels() == 1 && !container.isCompressed()) ? Texture::getLevelCount(width, height) : (int)container.getLevels();
+
+	applySampler();
 }
 
 const GLuint	&ArrayTexture::getId(void) const
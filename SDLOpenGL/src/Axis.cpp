@@ -24,6 +24,7 @@
 
 #include "Axis.h"
 #include "ObjectRenderer.h"
+#include "FrameStats.h"
 
 #define GLM_ENABLE_EXPERIMENTAL
 
@@ -45,17 +46,17 @@ Axis::~Axis(void)
 {
 }
 
-void Axis::render(const glm::mat4& lookAt, const glm::mat4& perspective)
+void Axis::render(const glm::vec2 &position, AxisType type, const glm::mat4& lookAt, const glm::mat4& perspective)
 {
 	// X - Red
-	drawAxis(1, 0, 0, glm::vec3(1, 0, 0), lookAt, perspective);
+	drawAxis(position, type, 1, 0, 0, glm::vec3(1, 0, 0), lookAt, perspective);
 
 	// Y - Green
-	drawAxis(0, 1, 1.5708, glm::vec3(0, 1, 0), lookAt, perspective);
+	drawAxis(position, type, 0, 1, 1.5708, glm::vec3(0, 1, 0), lookAt, perspective);
 }
 
 // Private
-void Axis::drawAxis(int x, int y, float angle, const glm::vec3 &color, const glm::mat4& lookAt, const glm::mat4& perspective)
+void Axis::drawAxis(const glm::vec2 &position, AxisType type, int x, int y, float angle, const glm::vec3 &color, const glm::mat4& lookAt, const glm::mat4& perspective)
 {
 	// Line
 	Grid::vaoBuffer->bind();
@@ -67,11 +68,12 @@ void Axis::drawAxis(int x, int y, float angle, const glm::vec3 &color, const glm
 	Grid::pShader->setVec4("color", glm::vec4(color, 1));
 
 	static glm::mat4 model;
-	model = glm::translate(glm::mat4(1.0f), glm::vec3(_pos.x, _pos.y, 0.0f));
+	model = glm::translate(glm::mat4(1.0f), glm::vec3(position.x, position.y, 0.0f));
 	model = glm::rotate(model, angle, glm::vec3(0, 0, 1));
 	Grid::pShader->setMat4("model", model);
 
 	GL_CALL(glDrawArrays(GL_LINES, 0, 2));
+	FrameStats::draw(0);
 
 	// Geometry
 	pShader->bind();
@@ -79,27 +81,29 @@ void Axis::drawAxis(int x, int y, float angle, const glm::vec3 &color, const glm
 	pShader->setMat4("view", lookAt);
 	pShader->setVec4("color", glm::vec4(color, 1));
 
-	switch (_type) {
+	switch (type) {
 		case AxisType::SCALE: {
 			ObjectRenderer::vaoBuffer->bind();
 			ObjectRenderer::vertexBuffer->bind();
 
-			model = glm::translate(glm::mat4(1.0f), glm::vec3(_pos.x + x, _pos.y + y, 0.0f));
+			model = glm::translate(glm::mat4(1.0f), glm::vec3(position.x + x, position.y + y, 0.0f));
 			model = glm::scale(model, glm::vec3(0.08f, 0.08f, 0.0f));
 			pShader->setMat4("model", model);
 
 			GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)0));
+			FrameStats::draw(2);
 			break;
 		}
 		default: // Translation
 			vaoBuffer->bind();
 			vertexBuffer->bind();
 
-			model = glm::translate(glm::mat4(1.0f), glm::vec3(_pos.x + x, _pos.y + y, 0.0f));
+			model = glm::translate(glm::mat4(1.0f), glm::vec3(position.x + x, position.y + y, 0.0f));
 			model = glm::rotate(model, (angle - 1.5708f), glm::vec3(0, 0, 1));
 			pShader->setMat4("model", model);
 
 			GL_CALL(glDrawArrays(GL_TRIANGLES, 0, 3));
+			FrameStats::draw(1);
 			break;
 	}
 }
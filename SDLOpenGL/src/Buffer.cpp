@@ -24,22 +24,25 @@
 
 #include "Buffer.h"
 #include "Texture.h"
+#include "FrameStats.h"
+#include "GPUMemory.h"
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
 
 Buffer::Buffer(void)
-: _id(0)
+: _bytes(0), _id(0)
 {	}
 
 Buffer::Buffer(unsigned long count, unsigned int size, const void* data, BufferType type, BufferDraw usage, unsigned char attribArray, bool normalized)
-: _id(0)
+: _bytes(0), _id(0)
 {
 	initialize(count, size, data, type, usage, attribArray, normalized);
 }
 
 Buffer::~Buffer(void)
 {
+	GPUMemory::release(MEMORY_BUFFERS, _bytes);
 	switch (_type)
 	{
 		case BufferType::VERTEXARRAY:
@@ -69,6 +72,8 @@ void Buffer::initialize(unsigned long count, unsigned int size, const void* data
 			GL_CALL(glGenBuffers(1, &_id));
 			GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, _id));
 			GL_CALL(glBufferData(GL_ARRAY_BUFFER, count * sizeof(GL_FLOAT), data, (usage == BufferDraw::STATIC ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW)));
+			_bytes = count * sizeof(GL_FLOAT);
+			GPUMemory::allocate(MEMORY_BUFFERS, _bytes);
 
 			GL_CALL(glEnableVertexAttribArray(attribArray));
 			GL_CALL(glVertexAttribPointer(attribArray, size, GL_FLOAT, (normalized ? GL_TRUE : GL_FALSE), 0, (void*)0));
@@ -77,6 +82,8 @@ void Buffer::initialize(unsigned long count, unsigned int size, const void* data
 			GL_CALL(glGenBuffers(1, &_id));
 			GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _id));
 			GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(GL_UNSIGNED_INT), data, (usage == BufferDraw::STATIC ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW)));
+			_bytes = count * sizeof(GL_UNSIGNED_INT);
+			GPUMemory::allocate(MEMORY_BUFFERS, _bytes);
 			break;
 		case BufferType::RENDERBUFFER:
 			GL_CALL(glGenRenderbuffers(1, &_id));
@@ -91,10 +98,37 @@ void Buffer::updateSubData(unsigned long count, const void* data)
 	{
 		bind();
 		GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(GL_FLOAT), data));
+		FrameStats::current.bufferBytes += count * sizeof(GL_FLOAT);
 		unbind();
 	}
 }
 
+void Buffer::stream(unsigned long count, const void* data)
+{
+	if (_type != BufferType::ARRAYBUFFER)
+		return ;
+
+	bind();
+	if (count > _count)
+	{
+		GPUMemory::release(MEMORY_BUFFERS, _bytes);
+		_count = count;
+		_bytes = count * sizeof(GL_FLOAT);
+		GPUMemory::allocate(MEMORY_BUFFERS, _bytes);
+	}
+	// The draws still reading the previous contents keep their own copy
+	GL_CALL(glBufferData(GL_ARRAY_BUFFER, _count * sizeof(GL_FLOAT), NULL, GL_STREAM_DRAW));
+	GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(GL_FLOAT), data));
+	FrameStats::current.bufferBytes += count * sizeof(GL_FLOAT);
+}
+
+void Buffer::setAttribute(unsigned char attribArray, unsigned int size, unsigned int stride, unsigned int offset, bool normalized)
+{
+	bind();
+	GL_CALL(glEnableVertexAttribArray(attribArray));
+	GL_CALL(glVertexAttribPointer(attribArray, size, GL_FLOAT, (normalized ? GL_TRUE : GL_FALSE), stride * sizeof(GL_FLOAT), (void*)(offset * sizeof(GL_FLOAT))));
+}
+
 void Buffer::bind(void) const
 {
 	switch (_type)
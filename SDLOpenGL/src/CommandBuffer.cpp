@@ -0,0 +1,127 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "CommandBuffer.h"
+
+using namespace ExoRendererSDLOpenGL;
+
+CommandBuffer::CommandBuffer(void)
+: _frame(0)
+{	}
+
+CommandBuffer::~CommandBuffer(void)
+{	}
+
+void CommandBuffer::clear(void)
+{
+	// Keep the capacity, a frame usually records as much as the previous one
+	_commands.clear();
+	_matrices.clear();
+	_vertices.clear();
+	_pixels.clear();
+	_stats.reset();
+}
+
+RenderCommand &CommandBuffer::push(RenderCommandType type)
+{
+	_commands.emplace_back();
+
+	RenderCommand &command = _commands.back();
+	command.type = type;
+	command.texture = 0;
+	command.matrix = 0;
+	command.first = 0;
+	command.count = 0;
+	command.object = nullptr;
+	return command;
+}
+
+unsigned int CommandBuffer::pushMatrix(const glm::mat4 &matrix)
+{
+	_matrices.push_back(matrix);
+	return (unsigned int)_matrices.size() - 1;
+}
+
+unsigned int CommandBuffer::pushVertices(const float *vertices, unsigned int count)
+{
+	unsigned int first = (unsigned int)_vertices.size();
+
+	_vertices.insert(_vertices.end(), vertices, vertices + count);
+	return first;
+}
+
+unsigned int CommandBuffer::pushPixels(const unsigned char *pixels, unsigned int count)
+{
+	unsigned int first = (unsigned int)_pixels.size();
+
+	_pixels.insert(_pixels.end(), pixels, pixels + count);
+	return first;
+}
+
+// Getters
+const std::vector<RenderCommand> &CommandBuffer::getCommands(void) const
+{
+	return _commands;
+}
+
+const glm::mat4 &CommandBuffer::getMatrix(unsigned int index) const
+{
+	return _matrices[index];
+}
+
+const float *CommandBuffer::getVertices(unsigned int first) const
+{
+	return _vertices.data() + first;
+}
+
+const unsigned char *CommandBuffer::getPixels(unsigned int first) const
+{
+	return _pixels.data() + first;
+}
+
+bool CommandBuffer::isEmpty(void) const
+{
+	return _commands.empty();
+}
+
+unsigned long CommandBuffer::getFrame(void) const
+{
+	return _frame;
+}
+
+ExoRenderer::RenderStats &CommandBuffer::getStats(void)
+{
+	return _stats;
+}
+
+const ExoRenderer::RenderStats &CommandBuffer::getStats(void) const
+{
+	return _stats;
+}
+
+// Setters
+void CommandBuffer::setFrame(unsigned long frame)
+{
+	_frame = frame;
+}
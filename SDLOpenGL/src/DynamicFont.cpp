@@ -0,0 +1,344 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "DynamicFont.h"
+#include "Texture.h"
+#include "RenderThread.h"
+#include "SDLException.h"
+#include "FrameStats.h"
+#include "Profiler.h"
+
+#include <climits>
+#include <cstring>
+#include <algorithm>
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+
+std::mutex	DynamicFont::_faceMutex;
+
+static_assert(DYNAMIC_FONT_MAX_PAGES <= 32, "a page is a bit of Font::getPages");
+
+DynamicFont::DynamicFont(const std::string& filePath, unsigned int size)
+: Font(), _pWorker(nullptr), _height(0), _generation(0), _frame(0)
+{
+	{
+		std::lock_guard<std::mutex> lock(_faceMutex);
+		_pFont = TTF_OpenFont(filePath.c_str(), (int)size);
+	}
+	if (!_pFont)
+		throw (SDLException());
+
+	_dirty[0] = _dirty[1] = INT_MAX;
+	_dirty[2] = _dirty[3] = 0;
+	grow();
+	_pWorker = new ThreadPool(1);
+}
+
+DynamicFont::~DynamicFont(void)
+{
+	// Waits for the glyph being rasterised, the queued ones are dropped
+	delete _pWorker;
+
+	std::lock_guard<std::mutex> lock(_faceMutex);
+	TTF_CloseFont(_pFont);
+}
+
+const CharDescriptor& DynamicFont::getCharacter(uint32_t character) const
+{
+	auto iterator = _glyphs.find(character);
+
+	if (iterator == _glyphs.end())
+	{
+		// Empty until rasterised, see update()
+		iterator = _glyphs.emplace(character, Glyph()).first;
+		_pWorker->post([this, character]() { rasterise(character); });
+	}
+	else if (iterator->second.page >= 0)
+		_pages[iterator->second.page].lastUsed = _frame;
+	return iterator->second.descriptor;
+}
+
+float DynamicFont::getKerning(uint32_t first, uint32_t second) const
+{
+	(void)first;
+	(void)second;
+	return 0.0f;
+}
+
+unsigned int DynamicFont::getGeneration() const
+{
+	return _generation;
+}
+
+uint32_t DynamicFont::getPages(uint32_t character) const
+{
+	auto iterator = _glyphs.find(character);
+
+	if (iterator == _glyphs.end() || iterator->second.page < 0)
+		return 0;
+	return 1u << iterator->second.page;
+}
+
+void DynamicFont::touch(uint32_t pages) const
+{
+	for (size_t page = 0; page < _pages.size(); page++)
+		if (pages & (1u << page))
+			_pages[page].lastUsed = _frame;
+}
+
+void DynamicFont::update(CommandBuffer& commands)
+{
+	EXO_PROFILE_ZONE("DynamicFont::update");
+	std::vector<Bitmap>	rasterised;
+	int					width;
+
+	// Each View records its labels with its own text renderer, the first one of the frame updates
+	if (commands.getFrame() == _frame)
+		return ;
+	_frame = commands.getFrame();
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		rasterised.swap(_rasterised);
+	}
+
+	for (const Bitmap& bitmap : rasterised)
+		place(bitmap);
+	if (!rasterised.empty())
+		_generation++;
+
+	if (_dirty[2] <= _dirty[0])
+		return ;
+
+	// A single region for every glyph packed since the last frame
+	RenderCommand &command = commands.push(RenderCommandType::GLYPHS);
+	width = _dirty[2] - _dirty[0];
+	command.texture = (GLuint)getTexture()->getEngineId();
+	command.param[0] = _dirty[0];
+	command.param[1] = _dirty[1];
+	command.param[2] = width;
+	command.param[3] = _dirty[3] - _dirty[1];
+	command.first = commands.pushPixels(&_pixels[(size_t)_dirty[1] * DYNAMIC_FONT_ATLAS_WIDTH + _dirty[0]], width);
+	for (int row = _dirty[1] + 1; row < _dirty[3]; row++)
+		commands.pushPixels(&_pixels[(size_t)row * DYNAMIC_FONT_ATLAS_WIDTH + _dirty[0]], width);
+
+	_dirty[0] = _dirty[1] = INT_MAX;
+	_dirty[2] = _dirty[3] = 0;
+}
+
+void DynamicFont::upload(const RenderCommand& command, const CommandBuffer& commands)
+{
+	Texture::bindBuffer(command.texture);
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, command.param[0], command.param[1], command.param[2], command.param[3], GL_RED, GL_UNSIGNED_BYTE, commands.getPixels(command.first)));
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+	FrameStats::uploadTexture((uint64_t)command.param[2] * command.param[3]);
+}
+
+// Getters
+size_t DynamicFont::getGlyphCount(void) const
+{
+	return _glyphs.size();
+}
+
+size_t DynamicFont::getPageCount(void) const
+{
+	return _pages.size();
+}
+
+// Private
+void DynamicFont::rasterise(uint32_t character) const
+{
+	const SDL_Color	white = {255, 255, 255, 255};
+	Bitmap			bitmap = {character, 0, 0, 0.0f, 0.0f, 0.0f, {}};
+	SDL_Surface		*surface = nullptr;
+	int				minX, maxX, minY, maxY, advance;
+
+	if (TTF_GlyphMetrics32(_pFont, character, &minX, &maxX, &minY, &maxY, &advance) == 0)
+	{
+		bitmap.xAdvance = (float)advance;
+		surface = TTF_RenderGlyph32_Blended(_pFont, character, white);
+	}
+
+	if (surface)
+	{
+		int	left = surface->w, top = surface->h, right = 0, bottom = 0;
+
+		// The surface spans the whole line, only the covered pixels are kept
+		for (int row = 0; row < surface->h; row++)
+		{
+			const uint32_t *pixels = (const uint32_t*)((const unsigned char*)surface->pixels + row * surface->pitch);
+
+			for (int column = 0; column < surface->w; column++)
+				if (pixels[column] >> 24)
+				{
+					left = std::min(left, column);
+					right = std::max(right, column + 1);
+					top = std::min(top, row);
+					bottom = row + 1;
+				}
+		}
+
+		if (right > left)
+		{
+			bitmap.width = right - left;
+			bitmap.height = bottom - top;
+			bitmap.xOffset = (float)left;
+			bitmap.yOffset = (float)top;
+			bitmap.coverage.resize((size_t)bitmap.width * bitmap.height);
+			for (int row = 0; row < bitmap.height; row++)
+			{
+				const uint32_t *pixels = (const uint32_t*)((const unsigned char*)surface->pixels + (top + row) * surface->pitch) + left;
+
+				for (int column = 0; column < bitmap.width; column++)
+					bitmap.coverage[(size_t)row * bitmap.width + column] = (unsigned char)(pixels[column] >> 24);
+			}
+		}
+		SDL_FreeSurface(surface);
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_rasterised.push_back(std::move(bitmap));
+}
+
+void DynamicFont::place(const Bitmap& bitmap)
+{
+	Glyph	&glyph = _glyphs[bitmap.character];
+	int		x, y, page;
+
+	glyph.descriptor.width = (unsigned short)bitmap.width;
+	glyph.descriptor.height = (unsigned short)bitmap.height;
+	glyph.descriptor.xOffset = bitmap.xOffset;
+	glyph.descriptor.yOffset = bitmap.yOffset;
+	glyph.descriptor.xAdvance = bitmap.xAdvance;
+
+	// Spaces and glyphs too tall for a page only advance
+	if (bitmap.coverage.empty() || bitmap.height + 2 * DYNAMIC_FONT_PADDING > DYNAMIC_FONT_PAGE_HEIGHT || bitmap.width + 2 * DYNAMIC_FONT_PADDING > DYNAMIC_FONT_ATLAS_WIDTH)
+	{
+		glyph.descriptor.width = 0;
+		glyph.descriptor.height = 0;
+		return ;
+	}
+
+	if ((page = allocate(bitmap.width + 2 * DYNAMIC_FONT_PADDING, bitmap.height + 2 * DYNAMIC_FONT_PADDING, x, y)) < 0)
+	{
+		// Every page holds glyphs of this frame, rasterised again once looked up
+		_glyphs.erase(bitmap.character);
+		return ;
+	}
+
+	glyph.page = page;
+	glyph.x = x + DYNAMIC_FONT_PADDING;
+	glyph.y = page * DYNAMIC_FONT_PAGE_HEIGHT + y + DYNAMIC_FONT_PADDING;
+	for (int row = 0; row < bitmap.height; row++)
+		std::memcpy(&_pixels[(size_t)(glyph.y + row) * DYNAMIC_FONT_ATLAS_WIDTH + glyph.x], &bitmap.coverage[(size_t)row * bitmap.width], bitmap.width);
+	markDirty(glyph.x, glyph.y, bitmap.width, bitmap.height);
+	setTextureCoordinates(glyph);
+}
+
+int DynamicFont::allocate(int width, int height, int& x, int& y)
+{
+	size_t	oldest = _pages.size();
+
+	for (size_t page = 0; page < _pages.size(); page++)
+		if (_pages[page].packer.insert(width, height, x, y))
+		{
+			_pages[page].lastUsed = _frame;
+			return (int)page;
+		}
+
+	if (_pages.size() < DYNAMIC_FONT_MAX_PAGES)
+	{
+		if ((int)(_pages.size() + 1) * DYNAMIC_FONT_PAGE_HEIGHT > _height)
+			grow();
+		_pages.push_back({RectPacker(DYNAMIC_FONT_ATLAS_WIDTH, DYNAMIC_FONT_PAGE_HEIGHT), _frame});
+		_pages.back().packer.insert(width, height, x, y);
+		return (int)_pages.size() - 1;
+	}
+
+	// The least recently used page, not one just packed
+	for (size_t page = 0; page < _pages.size(); page++)
+		if (_pages[page].lastUsed < _frame && (oldest == _pages.size() || _pages[page].lastUsed < _pages[oldest].lastUsed))
+			oldest = page;
+	if (oldest == _pages.size())
+		return -1;
+
+	evict(oldest);
+	_pages[oldest].packer.insert(width, height, x, y);
+	_pages[oldest].lastUsed = _frame;
+	return (int)oldest;
+}
+
+void DynamicFont::evict(size_t page)
+{
+	size_t	first = page * DYNAMIC_FONT_PAGE_HEIGHT * DYNAMIC_FONT_ATLAS_WIDTH;
+
+	// Its glyphs are rasterised again when next looked up, the labels using them are laid out again
+	for (auto iterator = _glyphs.begin(); iterator != _glyphs.end(); )
+	{
+		if (iterator->second.page == (int)page)
+			iterator = _glyphs.erase(iterator);
+		else
+			iterator++;
+	}
+
+	_pages[page].packer.clear();
+	std::fill(_pixels.begin() + first, _pixels.begin() + first + DYNAMIC_FONT_PAGE_HEIGHT * DYNAMIC_FONT_ATLAS_WIDTH, 0);
+	markDirty(0, (int)page * DYNAMIC_FONT_PAGE_HEIGHT, DYNAMIC_FONT_ATLAS_WIDTH, DYNAMIC_FONT_PAGE_HEIGHT);
+}
+
+// Twice as high, the whole atlas goes up again with the next upload
+void DynamicFont::grow(void)
+{
+	Texture	*texture = nullptr;
+	int		height = _height ? _height * 2 : DYNAMIC_FONT_PAGE_HEIGHT;
+
+	_pixels.resize((size_t)DYNAMIC_FONT_ATLAS_WIDTH * height, 0);
+	_height = height;
+	RenderThread::invoke([&]() { texture = new Texture(DYNAMIC_FONT_ATLAS_WIDTH, height, RED, TextureFilter::LINEAR, GL_CLAMP_TO_EDGE); });
+	setTexture(std::shared_ptr<ITexture>(texture));
+	markDirty(0, 0, DYNAMIC_FONT_ATLAS_WIDTH, height);
+
+	for (auto& glyph : _glyphs)
+		if (glyph.second.page >= 0)
+			setTextureCoordinates(glyph.second);
+	_generation++;
+}
+
+void DynamicFont::setTextureCoordinates(Glyph& glyph) const
+{
+	glyph.descriptor.x = (float)glyph.x / DYNAMIC_FONT_ATLAS_WIDTH;
+	glyph.descriptor.y = (float)glyph.y / _height;
+	glyph.descriptor.xMaxTextureCoord = (float)(glyph.x + glyph.descriptor.width) / DYNAMIC_FONT_ATLAS_WIDTH;
+	glyph.descriptor.yMaxTextureCoord = (float)(glyph.y + glyph.descriptor.height) / _height;
+}
+
+void DynamicFont::markDirty(int x, int y, int width, int height)
+{
+	_dirty[0] = std::min(_dirty[0], x);
+	_dirty[1] = std::min(_dirty[1], y);
+	_dirty[2] = std::max(_dirty[2], x + width);
+	_dirty[3] = std::max(_dirty[3], y + height);
+}
@@ -24,6 +24,7 @@
 
 #include "FrameBuffer.h"
 #include "Texture.h"
+#include "RenderThread.h"
 #include <stdexcept>
 
 using namespace ExoRenderer;
@@ -37,15 +38,19 @@ FrameBuffer::FrameBuffer(void) :
 
 FrameBuffer::~FrameBuffer(void)
 {
-	glDeleteFramebuffers(1, &_id);
+	GLuint	id = _id;
+
+	RenderThread::post([id]() { glDeleteFramebuffers(1, &id); });
 }
 
 void	FrameBuffer::attach(ITexture *texture)
 {
+	((Texture *)texture)->setCategory(MEMORY_FRAME_BUFFERS);
 	switch (((Texture *)texture)->getFormat())
 	{
 		case RGB:
 		case RGBA:
+		case RED:
 			GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, _id));
 			GL_CALL(glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture->getEngineId(), 0));
 			break;
@@ -70,6 +75,7 @@ void	FrameBuffer::detach(ITexture *texture)
 	{
 		case RGB:
 		case RGBA:
+		case RED:
 			GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, _id));
 			GL_CALL(glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0));
 			break;
@@ -0,0 +1,152 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "GPUMemory.h"
+#include "Texture.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+
+// Frames recorded ahead of the one executed, a texture bound since can't go
+#define GPU_MEMORY_MIN_IDLE_FRAMES	2
+
+std::atomic<uint64_t>			GPUMemory::_bytes[MEMORY_CATEGORY_MAX];
+std::atomic<uint64_t>			GPUMemory::_frame(0);
+std::atomic<uint64_t>			GPUMemory::_reloads(0);
+std::mutex						GPUMemory::_mutex;
+std::unordered_set<Texture*>	GPUMemory::_textures;
+uint64_t						GPUMemory::_budget = 0;
+unsigned int					GPUMemory::_idleFrames = MEMORY_IDLE_FRAMES;
+uint64_t						GPUMemory::_evictions = 0;
+uint64_t						GPUMemory::_overBudgetFrames = 0;
+
+void GPUMemory::allocate(MemoryCategory category, uint64_t bytes)
+{
+	_bytes[category].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void GPUMemory::release(MemoryCategory category, uint64_t bytes)
+{
+	_bytes[category].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void GPUMemory::reload(void)
+{
+	_reloads.fetch_add(1, std::memory_order_relaxed);
+}
+
+void GPUMemory::track(Texture *texture)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_textures.insert(texture);
+}
+
+void GPUMemory::untrack(Texture *texture)
+{
+	// Waits for an eviction in progress
+	std::lock_guard<std::mutex> lock(_mutex);
+	_textures.erase(texture);
+}
+
+void GPUMemory::endFrame(void)
+{
+	EXO_PROFILE_ZONE("GPUMemory::endFrame");
+
+	uint64_t				frame = _frame.fetch_add(1, std::memory_order_relaxed) + 1;
+	uint64_t				total = 0;
+	std::vector<Texture*>	idle;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (const std::atomic<uint64_t> &bytes : _bytes)
+		total += bytes.load(std::memory_order_relaxed);
+	if (_budget == 0 || total <= _budget)
+		return ;
+
+	for (Texture *texture : _textures)
+		if (texture->isResident() && texture->_lastUsed.load(std::memory_order_relaxed) + _idleFrames <= frame)
+			idle.push_back(texture);
+	std::sort(idle.begin(), idle.end(), [](const Texture *a, const Texture *b) {
+		return a->_lastUsed.load(std::memory_order_relaxed) < b->_lastUsed.load(std::memory_order_relaxed);
+	});
+
+	for (Texture *texture : idle)
+	{
+		if (total <= _budget)
+			break ;
+		total -= std::min(total, texture->evict());
+		_evictions++;
+	}
+
+	if (total > _budget)
+		_overBudgetFrames++;
+}
+
+// Getters
+uint64_t GPUMemory::getFrame(void)
+{
+	return _frame.load(std::memory_order_relaxed);
+}
+
+MemoryReport GPUMemory::getReport(void)
+{
+	MemoryReport	report;
+
+	for (int category = 0; category < MEMORY_CATEGORY_MAX; category++)
+		report.bytes[category] = _bytes[category].load(std::memory_order_relaxed);
+	report.reloads = _reloads.load(std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	report.budget = _budget;
+	report.evictions = _evictions;
+	report.overBudgetFrames = _overBudgetFrames;
+	for (Texture *texture : _textures)
+	{
+		if (texture->isResident())
+			report.evictable++;
+		else if (texture->_evicted.load(std::memory_order_relaxed))
+			report.evicted++;
+	}
+	return report;
+}
+
+uint64_t GPUMemory::getSize(uint64_t baseLevel, bool mipmapped)
+{
+	// Each level is a quarter of the previous one
+	return mipmapped ? baseLevel + baseLevel / 3 : baseLevel;
+}
+
+// Setters
+void GPUMemory::setBudget(uint64_t bytes, unsigned int idleFrames)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_budget = bytes;
+	_idleFrames = std::max(idleFrames, (unsigned int)GPU_MEMORY_MIN_IDLE_FRAMES);
+}
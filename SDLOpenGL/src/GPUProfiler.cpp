@@ -0,0 +1,246 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "GPUProfiler.h"
+
+#include <cstring>
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+
+GPUProfiler::GPUProfiler(void)
+: _enabled(false), _frameIndex(0)
+{
+	for (Frame &frame : _frames)
+	{
+		frame.used = 0;
+		frame.pending = false;
+	}
+}
+
+GPUProfiler::~GPUProfiler(void)
+{	}
+
+void GPUProfiler::push(const char *name)
+{
+	if (GLEW_KHR_debug)
+		glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+
+	if (!_enabled)
+		return ;
+
+	Frame &frame = _frames[_frameIndex];
+	Marker marker;
+
+	marker.name = name;
+	marker.depth = (unsigned int)_stack.size();
+	marker.begin = query(frame);
+	marker.end = 0;
+	GL_CALL(glQueryCounter(marker.begin, GL_TIMESTAMP));
+
+	_stack.push_back((unsigned int)frame.markers.size());
+	frame.markers.push_back(marker);
+}
+
+void GPUProfiler::pop(void)
+{
+	if (GLEW_KHR_debug)
+		glPopDebugGroup();
+
+	if (!_enabled || _stack.empty())
+		return ;
+
+	Frame &frame = _frames[_frameIndex];
+	Marker &marker = frame.markers[_stack.back()];
+
+	marker.end = query(frame);
+	GL_CALL(glQueryCounter(marker.end, GL_TIMESTAMP));
+	_stack.pop_back();
+}
+
+void GPUProfiler::endFrame(void)
+{
+	if (!_enabled)
+		return ;
+
+	// Passes left open are dropped with the frame
+	_stack.clear();
+	_frames[_frameIndex].pending = true;
+	_frameIndex = (_frameIndex + 1) % GPU_PROFILER_LATENCY;
+
+	// Oldest frame, its queries are about to be reused
+	Frame &frame = _frames[_frameIndex];
+	if (frame.pending)
+		resolve(frame);
+	frame.used = 0;
+	frame.markers.clear();
+	frame.pending = false;
+}
+
+void GPUProfiler::release(void)
+{
+	for (Frame &frame : _frames)
+	{
+		if (!frame.queries.empty())
+			glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+		frame.queries.clear();
+		frame.markers.clear();
+		frame.used = 0;
+		frame.pending = false;
+	}
+	_stack.clear();
+}
+
+// Getters
+bool GPUProfiler::isEnabled(void) const
+{
+	return _enabled;
+}
+
+std::vector<GPUPass> GPUProfiler::getPasses(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<GPUPass> passes;
+
+	exportPasses(_passes, passes);
+	return passes;
+}
+
+// Setters
+void GPUProfiler::setEnabled(bool enabled)
+{
+	if (enabled && !GLEW_ARB_timer_query)
+		enabled = false;
+
+	if (!enabled)
+		release();
+	_enabled = enabled;
+}
+
+// Private
+GLuint GPUProfiler::query(Frame &frame)
+{
+	if (frame.used == frame.queries.size())
+	{
+		GLuint id;
+
+		glGenQueries(1, &id);
+		frame.queries.push_back(id);
+	}
+	return frame.queries[frame.used++];
+}
+
+void GPUProfiler::resolve(Frame &frame)
+{
+	GLint available = 0;
+
+	if (frame.markers.empty())
+		return ;
+
+	// Still in flight after GPU_PROFILER_LATENCY frames, drop it instead of stalling
+	glGetQueryObjectiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available)
+		return ;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<Node*> parents;
+
+	for (const Marker &marker : frame.markers)
+	{
+		GLuint64 begin = 0;
+		GLuint64 end = 0;
+
+		glGetQueryObjectui64v(marker.begin, GL_QUERY_RESULT, &begin);
+		if (marker.end)
+			glGetQueryObjectui64v(marker.end, GL_QUERY_RESULT, &end);
+		else
+			end = begin;
+
+		parents.resize(marker.depth);
+		Node &node = findChild(marker.depth ? parents.back()->children : _passes, marker.name);
+		node.frameTime += (float)(end - begin) / 1000000.0f;
+		node.touched = true;
+		parents.push_back(&node);
+	}
+
+	commit(_passes);
+}
+
+GPUProfiler::Node &GPUProfiler::findChild(std::vector<Node> &nodes, const char *name)
+{
+	// Passes with the same name under the same parent are summed (e.g. views)
+	for (Node &node : nodes)
+	{
+		if (node.name == name)
+			return node;
+	}
+
+	nodes.emplace_back();
+
+	Node &node = nodes.back();
+	node.name = name;
+	node.frameTime = 0.0f;
+	node.touched = false;
+	node.last = 0.0f;
+	std::memset(node.history, 0, sizeof(node.history));
+	node.samples = 0;
+	node.next = 0;
+	return node;
+}
+
+void GPUProfiler::commit(std::vector<Node> &nodes)
+{
+	for (Node &node : nodes)
+	{
+		if (node.touched)
+		{
+			node.last = node.frameTime;
+			node.history[node.next] = node.frameTime;
+			node.next = (node.next + 1) % GPU_PROFILER_HISTORY;
+			if (node.samples < GPU_PROFILER_HISTORY)
+				node.samples++;
+
+			node.frameTime = 0.0f;
+			node.touched = false;
+		}
+		commit(node.children);
+	}
+}
+
+void GPUProfiler::exportPasses(const std::vector<Node> &nodes, std::vector<GPUPass> &passes)
+{
+	passes.resize(nodes.size());
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		float sum = 0.0f;
+
+		for (unsigned int sample = 0; sample < nodes[i].samples; sample++)
+			sum += nodes[i].history[sample];
+
+		passes[i].name = nodes[i].name;
+		passes[i].time = nodes[i].last;
+		passes[i].average = nodes[i].samples ? sum / nodes[i].samples : 0.0f;
+		exportPasses(nodes[i].children, passes[i].children);
+	}
+}
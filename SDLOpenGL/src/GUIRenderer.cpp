@@ -26,6 +26,8 @@
 
 #include "GUIRenderer.h"
 #include "RendererSDLOpenGL.h"
+#include "FrameStats.h"
+#include "Profiler.h"
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
@@ -33,7 +35,7 @@ using namespace ExoRendererSDLOpenGL;
 Shader* GUIRenderer::pGuiShader = nullptr;
 
 GUIRenderer::GUIRenderer(void)
-: _vaoBuffer(nullptr), _vertexBuffer(nullptr)
+: _projection(0), _opacity(0.0f), _numberOfRows(0.0f), _numberOfColumns(0.0f), _offset(0.0f), _vaoBuffer(nullptr), _vertexBuffer(nullptr), _views(0)
 {
 	const float tmp[] = {
 		-1.0f,	1.0f,
@@ -72,15 +74,21 @@ void GUIRenderer::remove(IWidget *widget)
 	}
 }
 
-void GUIRenderer::render(const glm::mat4& orthographic)
+void GUIRenderer::record(CommandBuffer& commands, const glm::mat4& orthographic)
 {
+	EXO_PROFILE_ZONE("GUIRenderer::record");
+
 	_orthographic = orthographic;
-	prepare(orthographic);
+	_projection = commands.pushMatrix(orthographic);
+	_views = 0;
+
+	commands.push(RenderCommandType::PUSH_PASS).object = "GUIRenderer";
+	prepare(commands);
 
 	for (IWidget* widget : _renderQueue)
 	{
-		if (render(widget, pGuiShader) == 1)
-			prepare(orthographic);
+		if (record(commands, widget) == 1)
+			prepare(commands);
 	}
 
 	// Front
@@ -90,77 +98,96 @@ void GUIRenderer::render(const glm::mat4& orthographic)
 		{
 			case IWidget::SELECT: {
 				auto select = (Select*)widget;
-				render(select->getView(), pGuiShader);
+				record(commands, select->getView());
 				break;
 			}
 			default: break;
 		}
 
-		prepare(_orthographic);
+		prepare(commands);
 	}
+	_renderFrontQueue.clear();
+
+	commands.push(RenderCommandType::POP_PASS);
 }
 
-// private
-void GUIRenderer::prepare(const glm::mat4& orthographic)
+void GUIRenderer::execute(const RenderCommand& command, const CommandBuffer& commands)
 {
-	pGuiShader->bind();
-	pGuiShader->setMat4("projection", orthographic);
+	switch (command.type)
+	{
+		case RenderCommandType::BEGIN_GUI:
+			pGuiShader->bind();
+			pGuiShader->setMat4("projection", commands.getMatrix(command.matrix));
+
+			// Render
+			_vaoBuffer->bind();
+			_vertexBuffer->bind();
+			break;
+		case RenderCommandType::GUI_QUAD:
+			renderQuad(command, commands);
+			break;
+		default: break;
+	}
+}
 
-	// Render
-	_vaoBuffer->bind();
-	_vertexBuffer->bind();
+// private
+void GUIRenderer::prepare(CommandBuffer& commands)
+{
+	commands.push(RenderCommandType::BEGIN_GUI).matrix = _projection;
 }
 
-unsigned char GUIRenderer::render(IWidget* widget, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, IWidget* widget)
 {
+	commands.getStats().widgets++;
+
 	switch (widget->getType())
 	{
 		case IWidget::BUTTON: {
 			auto button = (Button*)widget;
-			return render(button, shader);
+			return record(commands, button);
 		}
 		case IWidget::CHECKBOX: {
 			auto checkbox = (Checkbox*)widget;
-			return render(checkbox, shader);
+			return record(commands, checkbox);
 		}
 		case IWidget::SELECT: {
 			auto select = (Select*)widget;
-			return render(select, shader);
+			return record(commands, select);
 		}
 		case IWidget::INPUT: {
 			auto input = (Input*)widget;
-			return render(input, shader);
+			return record(commands, input);
 		}
 		case IWidget::SLIDER: {
 			auto slider = (Slider*)widget;
-			return render(slider, shader);
+			return record(commands, slider);
 		}
 		case IWidget::IMAGE: {
 			auto image = (Image*)widget;
-			return render(image, shader);
+			return record(commands, image);
 		}
 		case IWidget::SPINNER: {
 			auto spinner = (Spinner*)widget;
-			return render(spinner, shader);
+			return record(commands, spinner);
 		}
 		case IWidget::VIEW: {
 			auto view = (View*)widget;
-			return render(view, shader);
+			return record(commands, view);
 		}
 		default: return 0;
 	}
 }
 
-unsigned char GUIRenderer::render(Button* button, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Button* button)
 {
-	shader->setFloat("opacity", button->getOpacity());
-	button->getTexture()->bind();
+	_opacity = button->getOpacity();
 
 	if (button->getSliced())
 	{
-		shader->setFloat("numberOfRows", 3.0f);
-		shader->setFloat("numberOfColumns", 6.0f);
+		_numberOfRows = 3.0f;
+		_numberOfColumns = 6.0f;
 
+		const std::shared_ptr<ITexture>& texture = button->getTexture();
 		glm::vec2 tempPosition = button->getRealPosition() + button->getVirtualOffset() + button->getRelativeParentPosition();
 		bool isHoverOffset = button->getTextureIndex() == 1 ? true : false;
 
@@ -168,69 +195,66 @@ unsigned char GUIRenderer::render(Button* button, Shader* shader)
 		if (button->getScaleSize().y > button->getScaleSize().x)
 			cornerSize = button->getScaleSize().x / 3.0f;
 
-		drawSliced(shader, 0, 0, tempPosition.x - button->getScaleSize().x + cornerSize, tempPosition.y - button->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top left
-		drawSliced(shader, 0, 2, tempPosition.x - button->getScaleSize().x + cornerSize, tempPosition.y + button->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
-		drawSliced(shader, 1, 0, tempPosition.x, tempPosition.y - button->getScaleSize().y + cornerSize, button->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Top center
-		drawSliced(shader, 2, 0, tempPosition.x + button->getScaleSize().x - cornerSize, tempPosition.y - button->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top right
-		drawSliced(shader, 2, 1, tempPosition.x + button->getScaleSize().x - cornerSize, tempPosition.y, cornerSize, button->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center right
-		drawSliced(shader, 1, 2, tempPosition.x, tempPosition.y + button->getScaleSize().y - cornerSize, button->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Bottom center
-		drawSliced(shader, 2, 2, tempPosition.x + button->getScaleSize().x - cornerSize, tempPosition.y + button->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
-		drawSliced(shader, 0, 1, tempPosition.x - button->getScaleSize().x + cornerSize, tempPosition.y, cornerSize, button->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center left
-		drawSliced(shader, 1, 1, tempPosition.x, tempPosition.y, button->getScaleSize().x - cornerSize * 2, button->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);						// Center
+		drawSliced(commands, texture, 0, 0, tempPosition.x - button->getScaleSize().x + cornerSize, tempPosition.y - button->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top left
+		drawSliced(commands, texture, 0, 2, tempPosition.x - button->getScaleSize().x + cornerSize, tempPosition.y + button->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
+		drawSliced(commands, texture, 1, 0, tempPosition.x, tempPosition.y - button->getScaleSize().y + cornerSize, button->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Top center
+		drawSliced(commands, texture, 2, 0, tempPosition.x + button->getScaleSize().x - cornerSize, tempPosition.y - button->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top right
+		drawSliced(commands, texture, 2, 1, tempPosition.x + button->getScaleSize().x - cornerSize, tempPosition.y, cornerSize, button->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center right
+		drawSliced(commands, texture, 1, 2, tempPosition.x, tempPosition.y + button->getScaleSize().y - cornerSize, button->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Bottom center
+		drawSliced(commands, texture, 2, 2, tempPosition.x + button->getScaleSize().x - cornerSize, tempPosition.y + button->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
+		drawSliced(commands, texture, 0, 1, tempPosition.x - button->getScaleSize().x + cornerSize, tempPosition.y, cornerSize, button->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center left
+		drawSliced(commands, texture, 1, 1, tempPosition.x, tempPosition.y, button->getScaleSize().x - cornerSize * 2, button->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);						// Center
 	}
 	else
 	{
-		shader->setFloat("numberOfRows", button->getNumberOfRows());
-		shader->setFloat("numberOfColumns", button->getNumberOfColumns());
+		_numberOfRows = button->getNumberOfRows();
+		_numberOfColumns = button->getNumberOfColumns();
 
 		static glm::mat4 transformationMatrix;
 		transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(button->getRealPosition() + button->getVirtualOffset() + button->getRelativeParentPosition(), 0.0f)); // Translate
 		transformationMatrix = glm::scale(transformationMatrix, glm::vec3(button->getScaleSize(), 0.0f)); // Scale
-		shader->setMat4("transformation", transformationMatrix);
 
-		shader->setVec2("offset", button->getOffset());
-		GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+		_offset = button->getOffset();
+		drawQuad(commands, button->getTexture(), transformationMatrix);
 	}
 
 	return 0;
 }
 
-unsigned char GUIRenderer::render(Checkbox* checkbox, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Checkbox* checkbox)
 {
 	static glm::mat4 transformationMatrix;
 	transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(checkbox->getRealPosition() + checkbox->getVirtualOffset() + checkbox->getRelativeParentPosition(), 0.0f)); // Translate
 	transformationMatrix = glm::scale(transformationMatrix, glm::vec3(checkbox->getScaleSize(), 0.0f)); // Scale
-	shader->setMat4("transformation", transformationMatrix);
 
-	shader->setFloat("opacity", checkbox->getOpacity());
-	shader->setFloat("numberOfRows", 1.0f);
-	shader->setFloat("numberOfColumns", 4.0f);
-	shader->setVec2("offset", checkbox->getOffset());
+	_opacity = checkbox->getOpacity();
+	_numberOfRows = 1.0f;
+	_numberOfColumns = 4.0f;
+	_offset = checkbox->getOffset();
 
-	checkbox->getTexture()->bind();
-	GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+	drawQuad(commands, checkbox->getTexture(), transformationMatrix);
 
 	return 0;
 }
 
-unsigned char GUIRenderer::render(Select* select, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Select* select)
 {
 	if (select->isOpen())
 		_renderFrontQueue.push_back(select);
 
-	return render(select->getButton(), shader);
+	return record(commands, select->getButton());
 }
 
-unsigned char GUIRenderer::render(Input* input, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Input* input)
 {
-	shader->setFloat("opacity", input->getOpacity());
-	input->getTexture()->bind();
+	_opacity = input->getOpacity();
 
 	if (input->getSliced())
 	{
-		shader->setFloat("numberOfRows", 3.0f);
-		shader->setFloat("numberOfColumns", 6.0f);
+		_numberOfRows = 3.0f;
+		_numberOfColumns = 6.0f;
 
+		const std::shared_ptr<ITexture>& texture = input->getTexture();
 		glm::vec2 tempPosition = input->getRealPosition() + input->getVirtualOffset() + input->getRelativeParentPosition();
 		bool isHoverOffset = input->getSelected() == 1 ? true : false;
 
@@ -238,100 +262,100 @@ unsigned char GUIRenderer::render(Input* input, Shader* shader)
 		if (input->getScaleSize().y > input->getScaleSize().x)
 			cornerSize = input->getScaleSize().x / 3.0f;
 
-		drawSliced(shader, 0, 0, tempPosition.x - input->getScaleSize().x + cornerSize, tempPosition.y - input->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top left
-		drawSliced(shader, 0, 2, tempPosition.x - input->getScaleSize().x + cornerSize, tempPosition.y + input->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
-		drawSliced(shader, 1, 0, tempPosition.x, tempPosition.y - input->getScaleSize().y + cornerSize, input->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Top center
-		drawSliced(shader, 2, 0, tempPosition.x + input->getScaleSize().x - cornerSize, tempPosition.y - input->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top right
-		drawSliced(shader, 2, 1, tempPosition.x + input->getScaleSize().x - cornerSize, tempPosition.y, cornerSize, input->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center right
-		drawSliced(shader, 1, 2, tempPosition.x, tempPosition.y + input->getScaleSize().y - cornerSize, input->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Bottom center
-		drawSliced(shader, 2, 2, tempPosition.x + input->getScaleSize().x - cornerSize, tempPosition.y + input->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
-		drawSliced(shader, 0, 1, tempPosition.x - input->getScaleSize().x + cornerSize, tempPosition.y, cornerSize, input->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center left
-		drawSliced(shader, 1, 1, tempPosition.x, tempPosition.y, input->getScaleSize().x - cornerSize * 2, input->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);						// Center
+		drawSliced(commands, texture, 0, 0, tempPosition.x - input->getScaleSize().x + cornerSize, tempPosition.y - input->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top left
+		drawSliced(commands, texture, 0, 2, tempPosition.x - input->getScaleSize().x + cornerSize, tempPosition.y + input->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
+		drawSliced(commands, texture, 1, 0, tempPosition.x, tempPosition.y - input->getScaleSize().y + cornerSize, input->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Top center
+		drawSliced(commands, texture, 2, 0, tempPosition.x + input->getScaleSize().x - cornerSize, tempPosition.y - input->getScaleSize().y + cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Top right
+		drawSliced(commands, texture, 2, 1, tempPosition.x + input->getScaleSize().x - cornerSize, tempPosition.y, cornerSize, input->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center right
+		drawSliced(commands, texture, 1, 2, tempPosition.x, tempPosition.y + input->getScaleSize().y - cornerSize, input->getScaleSize().x - cornerSize * 2, cornerSize, isHoverOffset, 3, 6);			 // Bottom center
+		drawSliced(commands, texture, 2, 2, tempPosition.x + input->getScaleSize().x - cornerSize, tempPosition.y + input->getScaleSize().y - cornerSize, cornerSize, cornerSize, isHoverOffset, 3, 6);	// Bottom left
+		drawSliced(commands, texture, 0, 1, tempPosition.x - input->getScaleSize().x + cornerSize, tempPosition.y, cornerSize, input->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);			 // Center left
+		drawSliced(commands, texture, 1, 1, tempPosition.x, tempPosition.y, input->getScaleSize().x - cornerSize * 2, input->getScaleSize().y - cornerSize * 2, isHoverOffset, 3, 6);						// Center
 	}
 	else
 	{
-		shader->setFloat("numberOfRows", (float)input->getNumberOfRows());
-		shader->setFloat("numberOfColumns", (float)input->getNumberOfColumns());
+		_numberOfRows = (float)input->getNumberOfRows();
+		_numberOfColumns = (float)input->getNumberOfColumns();
 
 		static glm::mat4 transformationMatrix;
 		transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(input->getRealPosition() + input->getVirtualOffset() + input->getRelativeParentPosition(), 0.0f)); // Translate
 		transformationMatrix = glm::scale(transformationMatrix, glm::vec3(input->getScaleSize(), 0.0f)); // Scale
-		shader->setMat4("transformation", transformationMatrix);
 
-		shader->setVec2("offset", 0, 0);
-		GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+		_offset = glm::vec2(0.0f);
+		drawQuad(commands, input->getTexture(), transformationMatrix);
 	}
 	return 0;
 }
 
-unsigned char GUIRenderer::render(Image* image, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Image* image)
 {
 	static glm::mat4 transformationMatrix;
 	transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(image->getRealPosition() + image->getVirtualOffset() + image->getRelativeParentPosition(), 0.0f)); // Translate
 	transformationMatrix = glm::scale(transformationMatrix, glm::vec3(image->getScaleSize(), 0.0f)); // Scale
 	transformationMatrix = glm::rotate(transformationMatrix, image->getRotation(), glm::vec3(0, 0, 1)); // Rotation
-	shader->setMat4("transformation", transformationMatrix);
 
-	shader->setFloat("opacity", image->getOpacity());
-	shader->setFloat("numberOfRows", image->getNumberOfRows());
-	shader->setFloat("numberOfColumns", image->getNumberOfColumns());
-	shader->setVec2("offset", image->getOffset());
+	_opacity = image->getOpacity();
+	_numberOfRows = image->getNumberOfRows();
+	_numberOfColumns = image->getNumberOfColumns();
+	_offset = image->getOffset();
 
-	image->getTexture()->bind();
-	GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+	drawQuad(commands, image->getTexture(), transformationMatrix);
 
 	return 0;
 }
 
-unsigned char GUIRenderer::render(Spinner* spinner, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Spinner* spinner)
 {
 	static glm::mat4 transformationMatrix;
 	transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(spinner->getRealPosition() + spinner->getVirtualOffset() + spinner->getRelativeParentPosition(), 0.0f)); // Translate
 	transformationMatrix = glm::scale(transformationMatrix, glm::vec3(spinner->getScaleSize(), 0.0f)); // Scale
 	transformationMatrix = glm::rotate(transformationMatrix, spinner->getRotation(), glm::vec3(0, 0, 1)); // Rotation
-	shader->setMat4("transformation", transformationMatrix);
 
-	shader->setFloat("opacity", spinner->getOpacity());
-	shader->setFloat("numberOfRows", 1);
-	shader->setFloat("numberOfColumns", 1);
-	shader->setVec2("offset", 0, 0);
+	_opacity = spinner->getOpacity();
+	_numberOfRows = 1;
+	_numberOfColumns = 1;
+	_offset = glm::vec2(0.0f);
 
-	spinner->getTexture()->bind();
-	GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+	drawQuad(commands, spinner->getTexture(), transformationMatrix);
 
 	return 0;
 }
 
-unsigned char GUIRenderer::render(View* view, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, View* view)
 {
+	commands.push(RenderCommandType::PUSH_PASS).object = "View";
+
 	// Render background
 	if (view->getBackgroundTexture().get() != nullptr)
 	{
 		static glm::mat4 transformationMatrix;
 		transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(view->getRealPosition() + view->getVirtualOffset() + view->getRelativeParentPosition(), 0.0f)); // Translate
 		transformationMatrix = glm::scale(transformationMatrix, glm::vec3(view->getScaleSize(), 0.0f)); // Scale
-		shader->setMat4("transformation", transformationMatrix);
-		shader->setFloat("opacity", 0.0f);
+		_opacity = 0.0f;
 
-		view->getBackgroundTexture()->bind();
-		GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+		drawQuad(commands, view->getBackgroundTexture(), transformationMatrix);
 	}
 
 	// Render scroll
 	if (view->getLastScrollHeight() > view->getRealPosition().y + view->getRelativeParentPosition().y + view->getScaleSize().y)
 	{
 		auto scrollbarButton = view->getScrollbarButton();
-		render(scrollbarButton, shader);
+		record(commands, scrollbarButton);
 	}
 
 	// Render childs
-	RendererSDLOpenGL::Get().beginScissor(glm::vec2(view->getRealPosition().x + view->getVirtualOffset().x + view->getRelativeParentPosition().x - view->getScaleSize().x,
+	RendererSDLOpenGL::Get().beginScissor(commands,
+											glm::vec2(view->getRealPosition().x + view->getVirtualOffset().x + view->getRelativeParentPosition().x - view->getScaleSize().x,
 													RendererSDLOpenGL::Get().getWindow()->getHeight() - (view->getRealPosition().y + view->getVirtualOffset().y + view->getRelativeParentPosition().y + view->getScaleSize().y)),
 											glm::vec2(view->getScaleSize().x * 2, view->getScaleSize().y * 2),
 											glm::vec2(view->getParentScissor().x, view->getParentScissor().y),
 											glm::vec2(view->getParentScissor().z, view->getParentScissor().w));
 
-	TextRenderer tempTextRenderer;
+	// Nested views take the next ones, a reference into a deque survives growing it
+	if (_views == _viewTextRenderers.size())
+		_viewTextRenderers.emplace_back();
+	TextRenderer &textRenderer = _viewTextRenderers[_views++];
+	textRenderer.clear();
 
 	// Back
 	for (IWidget* widget : view->getRenderQueue())
@@ -343,54 +367,81 @@ unsigned char GUIRenderer::render(View* view, Shader* shader)
 		{
 			case IWidget::SELECT: {
 				auto select = (Select*)widget;
-				tempTextRenderer.add(select->getLabel());
+				textRenderer.add(select->getLabel());
 				break;
 			}
 			case IWidget::BUTTON: {
 				auto button = (Button*)widget;
-				tempTextRenderer.add(button->getLabel());
+				textRenderer.add(button->getLabel());
 				break;
 			}
 			case IWidget::INPUT: {
 				auto input = (Input*)widget;
-				tempTextRenderer.add(input->getLabel());
+				textRenderer.add(input->getLabel());
 				break;
 			}
 			default: break;
 		}
 
-		if (render(widget, shader) == 1)
-			prepare(_orthographic);
+		if (record(commands, widget) == 1)
+			prepare(commands);
 	}
 
 	for (Label* label : view->getLabelRenderQueue())
 	{
 		label->contextInfo(RendererSDLOpenGL::Get().getUIScaleFactor(), RendererSDLOpenGL::Get().getWindow()->getWidth(), RendererSDLOpenGL::Get().getWindow()->getHeight());
-		tempTextRenderer.add(label);
+		textRenderer.add(label);
 	}
-	tempTextRenderer.render(_orthographic);
-	prepare(_orthographic);
+	textRenderer.record(commands, _orthographic);
+	prepare(commands);
 
-	RendererSDLOpenGL::Get().endScissor();
+	RendererSDLOpenGL::Get().endScissor(commands);
+	commands.push(RenderCommandType::POP_PASS);
 
 	return 1;
 }
 
-unsigned char GUIRenderer::render(Slider* slider, Shader* shader)
+unsigned char GUIRenderer::record(CommandBuffer& commands, Slider* slider)
 {
-	render(slider->getBarImage(), shader);
-	render(slider->getSliderButton(), shader);
+	record(commands, slider->getBarImage());
+	record(commands, slider->getSliderButton());
 	return 0;
 }
 
-void GUIRenderer::drawSliced(Shader* shader, unsigned int offsetX, unsigned int offsetY, float positionX, float positionY, float sizeX, float sizeY, bool isHoverOffset, unsigned int numberOfRows, unsigned int numberOfColumns)
+void GUIRenderer::drawQuad(CommandBuffer& commands, const std::shared_ptr<ITexture>& texture, const glm::mat4& transformation)
+{
+	RenderCommand	&command = commands.push(RenderCommandType::GUI_QUAD);
+	glm::vec4		region = texture->getUVRect();
+
+	// Sprite sheet cell, then the atlas region it lives in
+	command.texture = (GLuint)texture->getEngineId();
+	command.matrix = commands.pushMatrix(transformation);
+	command.value[0] = _opacity;
+	command.value[1] = region.z / _numberOfRows;
+	command.value[2] = region.w / _numberOfColumns;
+	command.value[3] = region.x + _offset.x * region.z;
+	command.value[4] = region.y + _offset.y * region.w;
+}
+
+void GUIRenderer::drawSliced(CommandBuffer& commands, const std::shared_ptr<ITexture>& texture, unsigned int offsetX, unsigned int offsetY, float positionX, float positionY, float sizeX, float sizeY, bool isHoverOffset, unsigned int numberOfRows, unsigned int numberOfColumns)
 {
 	static glm::mat4 transformationMatrix;
 
 	transformationMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(positionX, positionY, 0.0f)); // Translate
 	transformationMatrix = glm::scale(transformationMatrix, glm::vec3(sizeX, sizeY, 0.0f)); // Scale
-	shader->setMat4("transformation", transformationMatrix);
 
-	shader->setVec2("offset", (float)offsetX / numberOfRows, ((offsetY + (isHoverOffset == true ? 3 : 0)) % numberOfColumns) / (float)numberOfColumns);
+	_offset = glm::vec2((float)offsetX / numberOfRows, ((offsetY + (isHoverOffset == true ? 3 : 0)) % numberOfColumns) / (float)numberOfColumns);
+	drawQuad(commands, texture, transformationMatrix);
+}
+
+void GUIRenderer::renderQuad(const RenderCommand& command, const CommandBuffer& commands)
+{
+	pGuiShader->setMat4("transformation", commands.getMatrix(command.matrix));
+	pGuiShader->setFloat("opacity", command.value[0]);
+	pGuiShader->setVec2("uvScale", command.value[1], command.value[2]);
+	pGuiShader->setVec2("uvOffset", command.value[3], command.value[4]);
+
+	Texture::bindBuffer(command.texture);
 	GL_CALL(glDrawArrays(GL_TRIANGLE_STRIP, 0, 4));
+	FrameStats::draw(2);
 }
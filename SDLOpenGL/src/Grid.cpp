@@ -23,6 +23,7 @@
  */
 
 #include "Grid.h"
+#include "FrameStats.h"
 
 #define GLM_ENABLE_EXPERIMENTAL
 
@@ -75,4 +76,5 @@ void Grid::drawLine(int x, int y, float angle)
 	pShader->setMat4("model", model);
 
 	GL_CALL(glDrawArrays(GL_LINES, 0, 2));
+	FrameStats::draw(0);
 }
@@ -23,6 +23,13 @@
  */
 
 #include "ObjectRenderer.h"
+#include "ArrayTexture.h"
+#include "SamplerCache.h"
+#include "Profiler.h"
+#include "FrameStats.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/geometric.hpp>
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
@@ -54,7 +61,7 @@ void ObjectRenderer::remove(const sprite &s)
 {
 	for (std::deque<sprite>::iterator iterator = _renderQueue.begin(); iterator != _renderQueue.end(); iterator++)
 	{
-		if (&*iterator == &s)
+		if (*iterator == s)
 		{
 			_renderQueue.erase(iterator);
 			return ;
@@ -62,16 +69,75 @@ void ObjectRenderer::remove(const sprite &s)
 	}
 }
 
-void ObjectRenderer::render(Camera* camera, const glm::mat4& perspective)
+void ObjectRenderer::record(CommandBuffer& commands, Camera* camera, const glm::mat4& perspective)
 {
+	EXO_PROFILE_ZONE("ObjectRenderer::record");
+
+	static glm::mat4 model;
+	glm::mat4 viewProjection = perspective * camera->getLookAt();
+	glm::vec4 planes[6];
+	unsigned int matrices = commands.pushMatrix(perspective);
+
+	commands.push(RenderCommandType::PUSH_PASS).object = "ObjectRenderer";
+	commands.pushMatrix(camera->getLookAt());
+
 	if (_gridEnabled)
-		_pGrid->render(camera->getLookAt(), perspective);
+	{
+		RenderCommand &grid = commands.push(RenderCommandType::GRID);
+		grid.matrix = matrices;
+		grid.object = _pGrid;
+	}
 
-	prepare(camera, perspective);
+	commands.push(RenderCommandType::BEGIN_OBJECTS).matrix = matrices;
+
+	// Frustum planes (left, right, bottom, top, near, far)
+	for (int i = 0; i < 3; i++)
+	{
+		glm::vec4 row(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+		glm::vec4 w(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+		planes[i * 2] = w + row;
+		planes[i * 2 + 1] = w - row;
+	}
 
 	for (sprite& object : _renderQueue)
 	{
-		renderObject(object, pShader);
+		if (!isVisible(planes, object))
+		{
+			commands.getStats().spritesCulled++;
+			continue ;
+		}
+		commands.getStats().spritesDrawn++;
+
+		model = glm::translate(glm::mat4(1.0f), glm::vec3(object.position, 0.0f));
+		model = glm::rotate(model, object.angle, glm::vec3(0, 0, 1));
+		model = glm::scale(model, glm::vec3(object.scale, 0.0f));
+
+		RenderCommand &command = commands.push(RenderCommandType::SPRITE);
+		command.texture = ((ArrayTexture*)object.texture.get())->getId();
+		command.matrix = commands.pushMatrix(model);
+		command.param[0] = (int)object.layer;
+		command.param[1] = object.flip == HORIZONTAL ? -1 : 1;
+		command.param[2] = object.flip == VERTICAL ? -1 : 1;
+	}
+
+	commands.push(RenderCommandType::POP_PASS);
+}
+
+void ObjectRenderer::execute(const RenderCommand& command, const CommandBuffer& commands)
+{
+	switch (command.type)
+	{
+		case RenderCommandType::GRID:
+			((Grid*)command.object)->render(commands.getMatrix(command.matrix + 1), commands.getMatrix(command.matrix));
+			break;
+		case RenderCommandType::BEGIN_OBJECTS:
+			prepare(commands.getMatrix(command.matrix), commands.getMatrix(command.matrix + 1));
+			break;
+		case RenderCommandType::SPRITE:
+			renderObject(command, commands, pShader);
+			break;
+		default: break;
 	}
 }
 
@@ -81,11 +147,11 @@ void ObjectRenderer::setGrid(bool val)
 }
 
 // Private
-void ObjectRenderer::prepare(Camera* camera, const glm::mat4& perspective)
+void ObjectRenderer::prepare(const glm::mat4& perspective, const glm::mat4& view)
 {
 	pShader->bind();
 	pShader->setMat4("projection", perspective);
-	pShader->setMat4("view", camera->getLookAt());
+	pShader->setMat4("view", view);
 
 	// Render
 	vaoBuffer->bind();
@@ -96,23 +162,37 @@ void ObjectRenderer::prepare(Camera* camera, const glm::mat4& perspective)
 	GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
 }
 
-void ObjectRenderer::renderObject(sprite& s, Shader* shader)
+bool ObjectRenderer::isVisible(const glm::vec4 planes[6], const sprite& s)
 {
-	static glm::mat4 model;
+	// Bounding circle of the unit quad once scaled, rotation doesn't matter
+	glm::vec3 center(s.position, 0.0f);
+	float radius = 0.5f * glm::length(s.scale);
 
-	s.texture->bind();
+	for (int i = 0; i < 6; i++)
+	{
+		glm::vec3 normal(planes[i]);
 
-	model = glm::translate(glm::mat4(1.0f), glm::vec3(s.position, 0.0f));
-	model = glm::rotate(model, s.angle, glm::vec3(0, 0, 1));
-	model = glm::scale(model, glm::vec3(s.scale, 0.0f));
-	shader->setMat4("model", model);
+		if (glm::dot(normal, center) + planes[i].w < -radius * glm::length(normal))
+			return false;
+	}
+	return true;
+}
+
+void ObjectRenderer::renderObject(const RenderCommand& command, const CommandBuffer& commands, Shader* shader)
+{
+	GL_CALL(glActiveTexture(GL_TEXTURE0));
+	GL_CALL(glBindTexture(GL_TEXTURE_2D_ARRAY, command.texture));
+	FrameStats::current.textureBinds++;
+	SamplerCache::bind(command.texture, 0);
+
+	shader->setMat4("model", commands.getMatrix(command.matrix));
 
-	shader->setInt("layer", (int)s.layer);
-	shader->setInt("flipHorizontal", s.flip == HORIZONTAL ? -1 : 1);
-	shader->setInt("flipVertical", s.flip == VERTICAL ? -1 : 1);
+	shader->setInt("layer", command.param[0]);
+	shader->setInt("flipHorizontal", command.param[1]);
+	shader->setInt("flipVertical", command.param[2]);
 
 	shader->setFloat("size", 1);
 
 	GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)0));
+	FrameStats::draw(2);
 }
-
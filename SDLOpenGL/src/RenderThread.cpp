@@ -0,0 +1,209 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "RenderThread.h"
+#include "Window.h"
+#include "Profiler.h"
+
+#include <exception>
+
+using namespace ExoRendererSDLOpenGL;
+
+RenderThread	*RenderThread::_pInstance = nullptr;
+
+static thread_local bool	g_isRenderThread = false;
+
+RenderThread::RenderThread(Window *window, const Executor &executor)
+: _pWindow(window), _executor(executor), _recordIndex(0), _framePending(false), _running(true), _jobsQueued(0), _jobsDone(0)
+{
+	// The context can only be current on one thread at a time
+	_pWindow->releaseContext();
+
+	_pInstance = this;
+	_thread = std::thread(&RenderThread::run, this);
+}
+
+RenderThread::~RenderThread(void)
+{
+	finish();
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_running = false;
+	}
+	_condition.notify_all();
+	_thread.join();
+
+	_pInstance = nullptr;
+	_pWindow->makeContextCurrent();
+
+	// Released while recording a frame that will never be submitted
+	runReleases(_releases[_recordIndex]);
+}
+
+CommandBuffer &RenderThread::getRecordBuffer(void)
+{
+	return _buffers[_recordIndex];
+}
+
+void RenderThread::submit(void)
+{
+	EXO_PROFILE_ZONE("RenderThread::submit");
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	// Wait for the previous frame, its buffer is about to be recorded into
+	_frameDone.wait(lock, [this]() { return !_framePending; });
+
+	_recordIndex = 1 - _recordIndex;
+	_buffers[_recordIndex].clear();
+	_framePending = true;
+
+	lock.unlock();
+	_condition.notify_all();
+}
+
+void RenderThread::finish(void)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	_frameDone.wait(lock, [this]() { return !_framePending && _jobsDone == _jobsQueued; });
+}
+
+void RenderThread::invoke(const std::function<void(void)> &job)
+{
+	RenderThread	*instance = _pInstance;
+
+	if (!instance || g_isRenderThread)
+	{
+		job();
+		return ;
+	}
+
+	std::exception_ptr	error;
+	std::unique_lock<std::mutex> lock(instance->_mutex);
+	unsigned long ticket = ++instance->_jobsQueued;
+
+	instance->_jobs.push_back([&job, &error]() {
+		try
+		{
+			job();
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+	});
+	instance->_condition.notify_all();
+	instance->_frameDone.wait(lock, [instance, ticket]() { return instance->_jobsDone >= ticket; });
+	lock.unlock();
+
+	// Errors are reported to the caller as if the job ran on its own thread
+	if (error)
+		std::rethrow_exception(error);
+}
+
+void RenderThread::post(const std::function<void(void)> &job)
+{
+	RenderThread	*instance = _pInstance;
+
+	if (!instance)
+	{
+		job();
+		return ;
+	}
+
+	// Tied to the frame being recorded, it is only run after that frame. From the GL thread
+	// too: a job run there for invoke() comes before the frame in flight is executed.
+	std::lock_guard<std::mutex> lock(instance->_mutex);
+	instance->_releases[instance->_recordIndex].push_back(job);
+}
+
+bool RenderThread::isActive(void)
+{
+	return _pInstance != nullptr;
+}
+
+// Private
+void RenderThread::run(void)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	g_isRenderThread = true;
+	_pWindow->makeContextCurrent();
+	ExoRenderer::Profiler::Get().setThreadName("RenderThread");
+
+	while (true)
+	{
+		_condition.wait(lock, [this]() { return hasWork() || !_running; });
+
+		runJobs(lock);
+
+		if (_framePending)
+		{
+			const CommandBuffer &buffer = _buffers[1 - _recordIndex];
+			std::vector<std::function<void(void)>> &releases = _releases[1 - _recordIndex];
+
+			lock.unlock();
+			_executor(buffer);
+			runReleases(releases);
+			lock.lock();
+
+			_framePending = false;
+			_frameDone.notify_all();
+		}
+		else if (!_running)
+			break;
+	}
+
+	_pWindow->releaseContext();
+}
+
+bool RenderThread::hasWork(void) const
+{
+	return _framePending || !_jobs.empty();
+}
+
+void RenderThread::runJobs(std::unique_lock<std::mutex> &lock)
+{
+	while (!_jobs.empty())
+	{
+		std::function<void(void)> job = _jobs.front();
+		_jobs.pop_front();
+
+		lock.unlock();
+		job();
+		lock.lock();
+
+		_jobsDone++;
+		_frameDone.notify_all();
+	}
+}
+
+void RenderThread::runReleases(std::vector<std::function<void(void)>> &releases)
+{
+	for (const std::function<void(void)> &job : releases)
+		job();
+	releases.clear();
+}
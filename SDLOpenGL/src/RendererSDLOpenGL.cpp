@@ -24,6 +24,8 @@
 
 #include "RendererSDLOpenGL.h"
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <stdexcept>
 
 #include "Button.h"
 #include "Input.h"
@@ -34,6 +36,9 @@
 #include "OrthogonalLight.h"
 #include "PerspectiveLight.h"
 #include "PointLight.h"
+#include "Profiler.h"
+#include "SamplerCache.h"
+#include "DynamicFont.h"
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
@@ -59,6 +64,16 @@ void				 RendererSDLOpenGL::Destroy(void)
 void RendererSDLOpenGL::initialize(const std::string& title, const int width, const int height, const WindowMode &mode, bool resizable)
 {
 	_scissorBit[0] = 0; _scissorBit[1] = 0; _scissorBit[2] = 0; _scissorBit[3] = 0;
+	_scissorBox[0] = 0; _scissorBox[1] = 0; _scissorBox[2] = 0; _scissorBox[3] = 0;
+
+	// The render thread owns the context of the window about to be destroyed
+	setRenderThread(false);
+	_gpuProfiler.release();
+
+	// Its buffers and placeholder belong to the old context, like the samplers
+	if (_pTextureLoader)
+		delete _pTextureLoader;
+	SamplerCache::clear();
 
 	// Destroy if window already exist
 	if (_pWindow)
@@ -72,6 +87,7 @@ void RendererSDLOpenGL::initialize(const std::string& title, const int width, co
 
 	// Buffers
 	createBuffers();
+	_pTextureLoader = new TextureLoader();
 
 	// Renderers
 	_pObjectRenderer = new ObjectRenderer();
@@ -103,13 +119,19 @@ ITexture* RendererSDLOpenGL::createTexture(const std::string& filePath, TextureF
 	ITexture	*texture;
 	GLsync		fenceId;
 
-	if (std::this_thread::get_id() != _mainThread)
+	if (_pRenderThread)
+	{
+		RenderThread::invoke([&]() { texture = new Texture(filePath, filter); });
+		return (texture);
+	}
+	else if (std::this_thread::get_id() != _mainThread)
 	{
 		_pWindow->handleThread();
 		texture = new Texture(filePath, filter);
 		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
 			;
+		glDeleteSync(fenceId);
 		return (texture);
 	}
 	else
@@ -121,35 +143,66 @@ ITexture* RendererSDLOpenGL::createTexture(unsigned int width, unsigned int heig
 	ITexture	*texture;
 	GLsync		fenceId;
 
-	if (std::this_thread::get_id() != _mainThread)
+	if (_pRenderThread)
+	{
+		RenderThread::invoke([&]() { texture = new Texture(width, height, format, filter); });
+		return (texture);
+	}
+	else if (std::this_thread::get_id() != _mainThread)
 	{
 		_pWindow->handleThread();
 		texture = new Texture(width, height, format, filter);
 		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
 			;
+		glDeleteSync(fenceId);
 		return (texture);
 	}
 	else
 		return (new Texture(width, height, format, filter));
 }
 
+ITexture* RendererSDLOpenGL::createTextureAsync(const std::string& filePath, TextureFilter filter)
+{
+	// No GL work here, the upload happens at the start of a frame
+	return (_pTextureLoader->load(filePath, filter));
+}
+
 IArrayTexture* RendererSDLOpenGL::createArrayTexture(int width, int height, std::vector<std::string> &textures, TextureFilter filter)
 {
 	ArrayTexture	*texture;
 	GLsync			fenceId;
+	ThreadPool		*workers = _pTextureLoader ? _pTextureLoader->getWorkers() : nullptr;
 
-	if (std::this_thread::get_id() != _mainThread)
+	if (_pRenderThread)
+	{
+		RenderThread::invoke([&]() { texture = new ArrayTexture(width, height, textures, filter, workers); });
+		return (texture);
+	}
+	else if (std::this_thread::get_id() != _mainThread)
 	{
 		_pWindow->handleThread();
-		texture = new ArrayTexture(width, height, textures, filter);
+		texture = new ArrayTexture(width, height, textures, filter, workers);
 		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
 			;
-		return (new ArrayTexture(width, height, textures, filter));
+		glDeleteSync(fenceId);
+		return (texture);
 	}
 	else
-		return (new ArrayTexture(width, height, textures, filter));
+		return (new ArrayTexture(width, height, textures, filter, workers));
+}
+
+ITextureAtlas* RendererSDLOpenGL::createTextureAtlas(int pageSize, int padding, TextureFilter filter)
+{
+	// Pages are created on demand, through RenderThread::invoke
+	return new TextureAtlas(pageSize, padding, filter);
+}
+
+Font* RendererSDLOpenGL::createDynamicFont(const std::string& filePath, unsigned int size)
+{
+	// Its atlas is created through RenderThread::invoke
+	return new DynamicFont(filePath, size);
 }
 
 ICursor* RendererSDLOpenGL::createCursor()
@@ -210,56 +263,17 @@ IView* RendererSDLOpenGL::createView(const std::shared_ptr<ITexture>& background
 
 ILight	*RendererSDLOpenGL::createOrthogonalLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const glm::vec2 &x, const glm::vec2 &y, const glm::vec2 &z)
 {
-	ILight		*light;
-	GLsync		fenceId;
-
-	if (std::this_thread::get_id() != _mainThread)
-	{
-		_pWindow->handleThread();
-		light = new OrthogonalLight(ambient, diffuse, pos, dir, up, x, y, z);
-		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
-			;
-		return (light);
-	}
-	else
-		return (new OrthogonalLight(ambient, diffuse, pos, dir, up, x, y, z));
+	return (new OrthogonalLight(ambient, diffuse, pos, dir, up, x, y, z));
 }
 
 ILight	*RendererSDLOpenGL::createPerspectivelLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const float &fovy, const float &aspect, const float &near, const float &far)
 {
-	ILight		*light;
-	GLsync		fenceId;
-
-	if (std::this_thread::get_id() != _mainThread)
-	{
-		_pWindow->handleThread();
-		light = new PerspectiveLight(ambient, diffuse, pos, dir, up, fovy, aspect, near, far);
-		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
-			;
-		return (light);
-	}
-	else
-		return (new PerspectiveLight(ambient, diffuse, pos, dir, up, fovy, aspect, near, far));
+	return (new PerspectiveLight(ambient, diffuse, pos, dir, up, fovy, aspect, near, far));
 }
 
 ILight	*RendererSDLOpenGL::createPointLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const float &fovy, const float &aspect, const float &near, const float &far)
 {
-	ILight		*light;
-	GLsync		fenceId;
-
-	if (std::this_thread::get_id() != _mainThread)
-	{
-		_pWindow->handleThread();
-		light = new PointLight(ambient, diffuse, pos, dir, up, fovy, aspect, near, far);
-		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
-			;
-		return (light);
-	}
-	else
-		return (new PointLight(ambient, diffuse, pos, dir, up, fovy, aspect, near, far));
+	return (new PointLight(ambient, diffuse, pos, dir, up, fovy, aspect, near, far));
 }
 
 IFrameBuffer	*RendererSDLOpenGL::createFrameBuffer(void)
@@ -267,13 +281,19 @@ IFrameBuffer	*RendererSDLOpenGL::createFrameBuffer(void)
 	IFrameBuffer	*frameBuffer;
 	GLsync			fenceId;
 
-	if (std::this_thread::get_id() != _mainThread)
+	if (_pRenderThread)
+	{
+		RenderThread::invoke([&]() { frameBuffer = new FrameBuffer(); });
+		return (frameBuffer);
+	}
+	else if (std::this_thread::get_id() != _mainThread)
 	{
 		_pWindow->handleThread();
 		frameBuffer = new FrameBuffer();
 		fenceId = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 		while(glClientWaitSync(fenceId, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000)) == GL_TIMEOUT_EXPIRED)
 			;
+		glDeleteSync(fenceId);
 		return (frameBuffer);
 	}
 	else
@@ -288,6 +308,8 @@ void RendererSDLOpenGL::add(sprite &s)
 
 void RendererSDLOpenGL::add(IWidget *widget)
 {
+	EXO_PROFILE_ZONE("IWidget::update");
+
 	widget->update(getMouse(), getKeyboard(), getGamepadManager()->getGamepad(0), getNavigationType());
 
 	// Update
@@ -374,46 +396,43 @@ void RendererSDLOpenGL::remove(std::shared_ptr<ILight> &light)
 
 void RendererSDLOpenGL::draw(void)
 {
-	// Renderers
-	if (_pCurrentCamera)
-	{
-		if (_pMousePicker)
-			_pMousePicker->update((IMouse*)&_mouse, _pWindow->getWidth(), _pWindow->getHeight(), ((Camera*)_pCurrentCamera)->getLookAt(), _perspective);
-
-		_pObjectRenderer->render((Camera*)_pCurrentCamera, _perspective);
+	EXO_PROFILE_ZONE("RendererSDLOpenGL::draw");
 
-		if (_pAxis)
-			((Axis*)_pAxis)->render(((Camera*)_pCurrentCamera)->getLookAt(), _perspective);
+	// Recorded for the render thread, replayed when swap() submits the frame
+	if (_pRenderThread)
+	{
+		record(_pRenderThread->getRecordBuffer());
+		return ;
 	}
 
-	GL_CALL(glEnable(GL_BLEND));
-	GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
-	_pGUIRenderer->render(_orthographic);
-	_pTextRenderer->render(_orthographic);
-
-	GL_CALL(glDisable(GL_BLEND));
+	_commands.clear();
+	record(_commands);
+	execute(_commands);
 }
 
 void RendererSDLOpenGL::swap(void)
 {
-	GL_CALL(glEnable(GL_BLEND));
-	GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+	EXO_PROFILE_ZONE("RendererSDLOpenGL::swap");
+
 	draw();
-	GL_CALL(glDisable(GL_BLEND));
 
 	_mouse.updateLastBuffer();
 	_keyboard.updateLastBuffer();
 	_gamepad.update();
 
 	_pWindow->handleEvents(_keyboard, _mouse, _gamepad);
-	_pCursor->update();
+	if (_pCursor)
+		_pCursor->update();
 
-	_pWindow->swap();
+	if (_pRenderThread)
+		_pRenderThread->submit();
+	else
+		present();
 
-	_pWindow->clearScreen();
+	_pWindow->updateDelta();
 }
 
-void RendererSDLOpenGL::beginScissor(glm::vec2 position, glm::vec2 size, glm::vec2 parentPosition, glm::vec2 parentSize)
+void RendererSDLOpenGL::beginScissor(CommandBuffer& commands, glm::vec2 position, glm::vec2 size, glm::vec2 parentPosition, glm::vec2 parentSize)
 {
 	position		*= (!_pWindow->isFullscreen() ? _pWindow->getHighDPIFactor() : 1);
 	size			*= (!_pWindow->isFullscreen() ? _pWindow->getHighDPIFactor() : 1);
@@ -422,7 +441,7 @@ void RendererSDLOpenGL::beginScissor(glm::vec2 position, glm::vec2 size, glm::ve
 
 	if (parentPosition.x != 0 && parentPosition.y != 0 && parentSize.x != 0 && parentSize.y != 0)
 	{
-		glGetIntegerv(GL_SCISSOR_BOX, _scissorBit);
+		std::copy(_scissorBox, _scissorBox + 4, _scissorBit);
 		// X
 		if (position.x + size.x > parentPosition.x + parentSize.x) // Right
 			size.x = (parentPosition.x + parentSize.x) - position.x;
@@ -444,14 +463,18 @@ void RendererSDLOpenGL::beginScissor(glm::vec2 position, glm::vec2 size, glm::ve
 		}
 	}
 
-	glEnable(GL_SCISSOR_TEST);
-	glScissor(position.x, position.y, size.x, size.y);
+	// The box is tracked here, it can't be read back from GL while recording
+	_scissorBox[0] = (int)position.x; _scissorBox[1] = (int)position.y; _scissorBox[2] = (int)size.x; _scissorBox[3] = (int)size.y;
+
+	RenderCommand &command = commands.push(RenderCommandType::BEGIN_SCISSOR);
+	std::copy(_scissorBox, _scissorBox + 4, command.param);
 }
 
-void RendererSDLOpenGL::endScissor(void)
+void RendererSDLOpenGL::endScissor(CommandBuffer& commands)
 {
-	glScissor(_scissorBit[0], _scissorBit[1], _scissorBit[2], _scissorBit[3]);
-	glDisable(GL_SCISSOR_TEST);
+	RenderCommand &command = commands.push(RenderCommandType::END_SCISSOR);
+	std::copy(_scissorBit, _scissorBit + 4, command.param);
+	std::copy(_scissorBit, _scissorBit + 4, _scissorBox);
 
 	// Reset
 	_scissorBit[0] = 0; _scissorBit[1] = 0; _scissorBit[2] = 0; _scissorBit[3] = 0;
@@ -483,6 +506,46 @@ unsigned int RendererSDLOpenGL::getTime(void) const
 	return SDL_GetTicks();
 }
 
+bool RendererSDLOpenGL::isRenderThreadEnabled(void) const
+{
+	return _pRenderThread != nullptr;
+}
+
+bool RendererSDLOpenGL::isGPUProfilingEnabled(void) const
+{
+	return _gpuProfiler.isEnabled();
+}
+
+std::vector<GPUPass> RendererSDLOpenGL::getGPUPasses(void)
+{
+	return _gpuProfiler.getPasses();
+}
+
+RenderStats RendererSDLOpenGL::getStats(void)
+{
+	std::lock_guard<std::mutex> lock(_statsMutex);
+
+	return _stats;
+}
+
+RenderStatsHistory RendererSDLOpenGL::getStatsHistory(void)
+{
+	std::lock_guard<std::mutex> lock(_statsMutex);
+
+	return _statsHistory;
+}
+
+void RendererSDLOpenGL::readFrame(std::vector<unsigned char> &pixels)
+{
+	// Runs between frames, the offscreen target still holds the last presented one
+	RenderThread::invoke([this, &pixels]() { _pWindow->readPixels(pixels); });
+}
+
+MemoryReport RendererSDLOpenGL::getMemoryReport(void)
+{
+	return GPUMemory::getReport();
+}
+
 // Setters
 void RendererSDLOpenGL::setCursor(ICursor* cursor)
 {
@@ -509,15 +572,60 @@ void RendererSDLOpenGL::setGridEnable(bool val)
 		_pObjectRenderer->setGrid(val);
 }
 
+void RendererSDLOpenGL::setRenderThread(bool enabled)
+{
+	if (enabled == (_pRenderThread != nullptr))
+		return ;
+
+	if (enabled)
+	{
+		if (!_pWindow)
+			throw (std::logic_error("cannot start the render thread before initialize"));
+		_pRenderThread = new RenderThread(_pWindow, [this](const CommandBuffer& commands) {
+			execute(commands);
+			present();
+		});
+	}
+	else
+	{
+		// Waits for the frame in flight and gives the context back to this thread
+		delete _pRenderThread;
+		_pRenderThread = nullptr;
+	}
+}
+
+void RendererSDLOpenGL::setGPUProfiling(bool enabled)
+{
+	// Queries belong to the context
+	RenderThread::invoke([this, enabled]() { _gpuProfiler.setEnabled(enabled); });
+}
+
+void RendererSDLOpenGL::setTextureUploadBudget(size_t bytes)
+{
+	RenderThread::invoke([this, bytes]() { _pTextureLoader->setBudget(bytes); });
+}
+
+void RendererSDLOpenGL::setMemoryBudget(uint64_t bytes, unsigned int idleFrames)
+{
+	GPUMemory::setBudget(bytes, idleFrames);
+}
+
 // Private
 RendererSDLOpenGL::RendererSDLOpenGL(void)
-: IRenderer(), _pWindow(nullptr), _pObjectRenderer(nullptr), _pGUIRenderer(nullptr), _pTextRenderer(nullptr), _pCursor(nullptr)
+: IRenderer(), _pWindow(nullptr), _pObjectRenderer(nullptr), _pGUIRenderer(nullptr), _pTextRenderer(nullptr), _pRenderThread(nullptr), _pTextureLoader(nullptr), _frameCleared(false), _recordedFrames(0), _pCursor(nullptr)
 {
 	_mainThread = std::this_thread::get_id();
 }
 
 RendererSDLOpenGL::~RendererSDLOpenGL(void)
 {
+	setRenderThread(false);
+	_gpuProfiler.release();
+
+	if (_pTextureLoader)
+		delete _pTextureLoader;
+	SamplerCache::clear();
+
 	if (_pWindow)
 		delete _pWindow;
 
@@ -580,7 +688,9 @@ void RendererSDLOpenGL::createBuffers(void)
 
 	// TextRenderer
 	TextRenderer::vaoBuffer = new Buffer(0, 0, NULL, BufferType::VERTEXARRAY, BufferDraw::STATIC, 0, false);
-	TextRenderer::vertexBuffer = new Buffer(24, 4, NULL, BufferType::ARRAYBUFFER, BufferDraw::DYNAMIC, 0, false);
+	TextRenderer::vertexBuffer = new Buffer(TEXT_GLYPH_FLOATS * 64, 4, NULL, BufferType::ARRAYBUFFER, BufferDraw::DYNAMIC, 0, false);
+	TextRenderer::vertexBuffer->setAttribute(0, 4, TEXT_VERTEX_FLOATS, 0, false);
+	TextRenderer::vertexBuffer->setAttribute(1, 3, TEXT_VERTEX_FLOATS, 4, false);
 
 	// Grid
 	const float line[] = {
@@ -670,13 +780,12 @@ static const std::vector<std::string>	g_guiShader = {
 	"",
 	"uniform sampler2D guiTexture;",
 	"uniform float opacity;",
-	"uniform float numberOfRows;",
-	"uniform float numberOfColumns;",
-	"uniform vec2 offset;",
+	"uniform vec2 uvScale;",
+	"uniform vec2 uvOffset;",
 	"",
 	"void main(void)",
 	"{    ",
-	"    color = texture(guiTexture, vec2(TexCoords.x / numberOfRows, TexCoords.y / numberOfColumns) + offset);",
+	"    color = texture(guiTexture, TexCoords * uvScale + uvOffset);",
 	"    color.a = color.a - opacity;",
 	"}"
 };
@@ -684,29 +793,74 @@ static const std::vector<std::string>	g_guiShader = {
 static const std::vector<std::string>	g_fontShader = {
 	"#version 330 core",
 	"layout (location = 0) in vec4 vertex;",
+	"layout (location = 1) in vec3 color;",
 	"",
 	"uniform mat4 projection;",
 	"",
 	"out vec2 TexCoords;",
+	"out vec3 TextColor;",
 	"",
 	"void main()",
 	"{",
 	"    gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);",
 	"    TexCoords = vertex.zw;",
+	"    TextColor = color;",
 	"}",
 	"",
 	"#FRAGMENT",
 	"#version 330 core",
 	"",
 	"in vec2 TexCoords;",
+	"in vec3 TextColor;",
 	"out vec4 color;",
 	"",
 	"uniform sampler2D fontAtlas;",
-	"uniform vec3 textColor;",
+	"uniform int fontType;",
+	"uniform float distanceRange;",
+	"uniform float outlineWidth;",
+	"uniform vec4 outlineColor;",
+	"uniform vec4 shadowColor;",
+	"uniform vec2 shadowOffset;",
+	"",
+	"float median(vec3 v)",
+	"{",
+	"    return max(min(v.r, v.g), min(max(v.r, v.g), v.b));",
+	"}",
+	"",
+	"// Covered fraction of the pixel, the glyph grown by grow atlas pixels",
+	"float coverage(vec2 uv, float grow, float pixelScale)",
+	"{",
+	"    vec4 texel = texture(fontAtlas, uv);",
+	"",
+	"    if (fontType == 0)",
+	"        return texel.r;",
+	"    float signedDistance = (fontType == 2 ? median(texel.rgb) : texel.r) - 0.5;",
+	"    return clamp((signedDistance * distanceRange + grow) * pixelScale + 0.5, 0.0, 1.0);",
+	"}",
 	"",
 	"void main()",
 	"{    ",
-	"    color = vec4(textColor, texture(fontAtlas, TexCoords).r);",
+	"    vec2 atlasSize = vec2(textureSize(fontAtlas, 0));",
+	"    // Screen pixels per atlas pixel, at least one pixel of distance range to stay antialiased",
+	"    vec2 screenScale = vec2(1.0) / (fwidth(TexCoords) * atlasSize);",
+	"    float pixelScale = max(0.5 * (screenScale.x + screenScale.y), 1.0 / max(distanceRange, 1.0));",
+	"",
+	"    float fill = coverage(TexCoords, 0.0, pixelScale);",
+	"    float outline = outlineColor.a > 0.0 && fontType != 0 ? coverage(TexCoords, outlineWidth, pixelScale) * outlineColor.a : 0.0;",
+	"    vec4 glyph = vec4(TextColor, fill + outline * (1.0 - fill));",
+	"",
+	"    // Composited front to back: fill, outline, shadow",
+	"    glyph.rgb = (TextColor * fill + outlineColor.rgb * outline * (1.0 - fill)) / max(glyph.a, 0.0001);",
+	"",
+	"    if (shadowColor.a > 0.0)",
+	"    {",
+	"        float shadow = coverage(TexCoords - shadowOffset / atlasSize, fontType != 0 ? outlineWidth : 0.0, pixelScale) * shadowColor.a;",
+	"        float alpha = glyph.a + shadow * (1.0 - glyph.a);",
+	"",
+	"        glyph.rgb = (glyph.rgb * glyph.a + shadowColor.rgb * shadow * (1.0 - glyph.a)) / max(alpha, 0.0001);",
+	"        glyph.a = alpha;",
+	"    }",
+	"    color = glyph;",
 	"}"
 };
 
@@ -788,3 +942,131 @@ void RendererSDLOpenGL::loadShaders(void)
 	Axis::pShader = new Shader(g_axisShader);
 #endif
 }
+
+void RendererSDLOpenGL::record(CommandBuffer& commands)
+{
+	commands.setFrame(++_recordedFrames);
+	commands.getStats().frameTime = _pWindow->getDelta();
+	commands.push(RenderCommandType::BLEND).param[0] = 1;
+
+	// Renderers
+	if (_pCurrentCamera)
+	{
+		if (_pMousePicker)
+			_pMousePicker->update((IMouse*)&_mouse, _pWindow->getWidth(), _pWindow->getHeight(), ((Camera*)_pCurrentCamera)->getLookAt(), _perspective);
+
+		_pObjectRenderer->record(commands, (Camera*)_pCurrentCamera, _perspective);
+
+		if (_pAxis)
+		{
+			RenderCommand &axis = commands.push(RenderCommandType::AXIS);
+			axis.matrix = commands.pushMatrix(_perspective);
+			commands.pushMatrix(((Camera*)_pCurrentCamera)->getLookAt());
+			axis.param[0] = (int)_pAxis->getType();
+			axis.value[0] = _pAxis->getPosition().x;
+			axis.value[1] = _pAxis->getPosition().y;
+		}
+	}
+
+	commands.push(RenderCommandType::BLEND).param[0] = 1;
+	_pGUIRenderer->record(commands, _orthographic);
+	_pTextRenderer->record(commands, _orthographic);
+
+	commands.push(RenderCommandType::BLEND).param[0] = 0;
+}
+
+void RendererSDLOpenGL::execute(const CommandBuffer& commands)
+{
+	EXO_PROFILE_ZONE("RendererSDLOpenGL::execute");
+	const RenderStats &recorded = commands.getStats();
+
+	FrameStats::current.spritesDrawn += recorded.spritesDrawn;
+	FrameStats::current.spritesCulled += recorded.spritesCulled;
+	FrameStats::current.widgets += recorded.widgets;
+	FrameStats::current.glyphs += recorded.glyphs;
+	FrameStats::current.frameTime = recorded.frameTime;
+
+	// Cleared lazily so the last presented frame can be read back until the next one
+	if (!_frameCleared)
+	{
+		_pWindow->clearScreen();
+		_frameCleared = true;
+
+		// Once per frame, before anything samples them
+		_pTextureLoader->upload();
+	}
+
+	for (const RenderCommand& command : commands.getCommands())
+	{
+		switch (command.type)
+		{
+			case RenderCommandType::BLEND:
+				if (command.param[0])
+				{
+					GL_CALL(glEnable(GL_BLEND));
+					GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+				}
+				else
+					GL_CALL(glDisable(GL_BLEND));
+				break;
+			case RenderCommandType::GRID:
+			case RenderCommandType::BEGIN_OBJECTS:
+			case RenderCommandType::SPRITE:
+				ObjectRenderer::execute(command, commands);
+				break;
+			case RenderCommandType::AXIS:
+				Axis::render(glm::vec2(command.value[0], command.value[1]), (AxisType)command.param[0], commands.getMatrix(command.matrix + 1), commands.getMatrix(command.matrix));
+				break;
+			case RenderCommandType::BEGIN_GUI:
+			case RenderCommandType::GUI_QUAD:
+				_pGUIRenderer->execute(command, commands);
+				break;
+			case RenderCommandType::BEGIN_TEXT:
+			case RenderCommandType::GLYPHS:
+			case RenderCommandType::TEXT:
+				TextRenderer::execute(command, commands);
+				break;
+			case RenderCommandType::BEGIN_SCISSOR:
+				glEnable(GL_SCISSOR_TEST);
+				glScissor(command.param[0], command.param[1], command.param[2], command.param[3]);
+				FrameStats::current.scissorChanges++;
+				break;
+			case RenderCommandType::END_SCISSOR:
+				glScissor(command.param[0], command.param[1], command.param[2], command.param[3]);
+				glDisable(GL_SCISSOR_TEST);
+				FrameStats::current.scissorChanges++;
+				break;
+			case RenderCommandType::PUSH_PASS:
+				_gpuProfiler.push((const char*)command.object);
+				break;
+			case RenderCommandType::POP_PASS:
+				_gpuProfiler.pop();
+				break;
+		}
+	}
+}
+
+void RendererSDLOpenGL::present(void)
+{
+	EXO_PROFILE_ZONE("RendererSDLOpenGL::present");
+
+	_gpuProfiler.push("Window::postProcess");
+	_pWindow->postProcess();
+	_gpuProfiler.pop();
+
+	_pWindow->swap();
+	_frameCleared = false;
+	_gpuProfiler.endFrame();
+
+	// Uploads done by loader threads since the last frame
+	FrameStats::current.textureBytes += FrameStats::textureBytes.exchange(0);
+	{
+		std::lock_guard<std::mutex> lock(_statsMutex);
+		_stats = FrameStats::current;
+		_statsHistory.push(FrameStats::current);
+	}
+	FrameStats::current.reset();
+
+	// Between frames, nothing bound is in use
+	GPUMemory::endFrame();
+}
@@ -0,0 +1,140 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "SamplerCache.h"
+#include "Texture.h"
+
+#include <algorithm>
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+
+std::vector<SamplerCache::Entry>		SamplerCache::_samplers;
+std::unordered_map<GLuint, GLuint>		SamplerCache::_textures;
+GLuint									SamplerCache::_bound[SAMPLER_CACHE_UNITS] = {0};
+std::mutex								SamplerCache::_mutex;
+
+bool SamplerState::operator==(const SamplerState &other) const
+{
+	return filter == other.filter && wrap == other.wrap && lodBias == other.lodBias && minLod == other.minLod && maxLod == other.maxLod;
+}
+
+void SamplerCache::apply(GLuint texture, GLenum target, const SamplerState &state)
+{
+	if (isSupported())
+	{
+		GLuint	sampler = getSampler(state);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		_textures[texture] = sampler;
+	}
+	else
+		applyParameters(target, state);
+}
+
+void SamplerCache::remove(GLuint texture)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_textures.erase(texture);
+}
+
+void SamplerCache::bind(GLuint texture, int unit)
+{
+	GLuint	sampler = 0;
+
+	if (!isSupported())
+		return ;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto iterator = _textures.find(texture);
+	if (iterator != _textures.end())
+		sampler = iterator->second;
+	if (unit < SAMPLER_CACHE_UNITS)
+	{
+		if (_bound[unit] == sampler)
+			return ;
+		_bound[unit] = sampler;
+	}
+	GL_CALL(glBindSampler(unit, sampler));
+}
+
+void SamplerCache::clear(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (const Entry &entry : _samplers)
+		GL_CALL(glDeleteSamplers(1, &entry.sampler));
+	_samplers.clear();
+	_textures.clear();
+	std::fill(_bound, _bound + SAMPLER_CACHE_UNITS, 0);
+}
+
+// Getters
+GLuint SamplerCache::getSampler(const SamplerState &state)
+{
+	std::lock_guard<std::mutex>	lock(_mutex);
+	Entry						entry;
+
+	for (const Entry &candidate : _samplers)
+		if (candidate.state == state)
+			return candidate.sampler;
+
+	entry.state = state;
+	GL_CALL(glGenSamplers(1, &entry.sampler));
+	GL_CALL(glSamplerParameteri(entry.sampler, GL_TEXTURE_MIN_FILTER, Texture::getMinFilter(state.filter)));
+	GL_CALL(glSamplerParameteri(entry.sampler, GL_TEXTURE_MAG_FILTER, Texture::getMagFilter(state.filter)));
+	GL_CALL(glSamplerParameteri(entry.sampler, GL_TEXTURE_WRAP_S, state.wrap));
+	GL_CALL(glSamplerParameteri(entry.sampler, GL_TEXTURE_WRAP_T, state.wrap));
+	GL_CALL(glSamplerParameterf(entry.sampler, GL_TEXTURE_LOD_BIAS, state.lodBias));
+	GL_CALL(glSamplerParameterf(entry.sampler, GL_TEXTURE_MIN_LOD, state.minLod));
+	GL_CALL(glSamplerParameterf(entry.sampler, GL_TEXTURE_MAX_LOD, state.maxLod));
+	if (state.filter == TextureFilter::ANISOTROPIC && Texture::getAnisotropy() > 1.0f)
+		GL_CALL(glSamplerParameterf(entry.sampler, GL_TEXTURE_MAX_ANISOTROPY_EXT, Texture::getAnisotropy()));
+	_samplers.push_back(entry);
+	return entry.sampler;
+}
+
+size_t SamplerCache::getCount(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _samplers.size();
+}
+
+bool SamplerCache::isSupported(void)
+{
+	return GLEW_VERSION_3_3 || GLEW_ARB_sampler_objects;
+}
+
+// Private
+void SamplerCache::applyParameters(GLenum target, const SamplerState &state)
+{
+	Texture::applyFilter(state.filter, target);
+	GL_CALL(glTexParameteri(target, GL_TEXTURE_WRAP_S, state.wrap));
+	GL_CALL(glTexParameteri(target, GL_TEXTURE_WRAP_T, state.wrap));
+	GL_CALL(glTexParameterf(target, GL_TEXTURE_LOD_BIAS, state.lodBias));
+	GL_CALL(glTexParameterf(target, GL_TEXTURE_MIN_LOD, state.minLod));
+	GL_CALL(glTexParameterf(target, GL_TEXTURE_MAX_LOD, state.maxLod));
+}
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "Shader.h"
+#include "FrameStats.h"
 #include "OGLCall.h"
 
 using namespace ExoRenderer;
@@ -134,6 +135,7 @@ void Shader::initialize(const std::vector<std::string>& shaderSource)
 void Shader::bind(void) const
 {
 	GL_CALL(glUseProgram(_programId));
+	FrameStats::current.programBinds++;
 }
 
 void Shader::unbind(void) const
@@ -145,46 +147,55 @@ void Shader::unbind(void) const
 void Shader::setMat4(const std::string& name, const glm::mat4 &value) const
 {
 	GL_CALL(glUniformMatrix4fv(glGetUniformLocation(_programId, name.c_str()), 1, GL_FALSE, glm::value_ptr(value)));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setVec4(const std::string& name, const glm::vec4& value) const
 {
 	GL_CALL(glUniform4fv(glGetUniformLocation(_programId, name.c_str()), 1, &value[0]));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setVec4(const std::string& name, float x, float y, float z, float w) const
 {
 	GL_CALL(glUniform4f(glGetUniformLocation(_programId, name.c_str()), x, y, z, w));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setVec3(const std::string& name, const glm::vec3 &value) const
 {
 	GL_CALL(glUniform3fv(glGetUniformLocation(_programId, name.c_str()), 1, &value[0]));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setVec3(const std::string& name, float x, float y, float z) const
 {
 	GL_CALL(glUniform3f(glGetUniformLocation(_programId, name.c_str()), x, y, z));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setVec2(const std::string& name, const glm::vec2 &value) const
 {
 	GL_CALL(glUniform2fv(glGetUniformLocation(_programId, name.c_str()), 1, &value[0]));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setVec2(const std::string& name, float x, float y) const
 {
 	GL_CALL(glUniform2f(glGetUniformLocation(_programId, name.c_str()), x, y));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setFloat(const std::string& name, const float &value) const
 {
 	GL_CALL(glUniform1f(glGetUniformLocation(_programId, name.c_str()), value));
+	FrameStats::current.uniformUploads++;
 }
 
 void Shader::setInt(const std::string& name, const int &value) const
 {
 	GL_CALL(glUniform1i(glGetUniformLocation(_programId, name.c_str()), value));
+	FrameStats::current.uniformUploads++;
 }
 
 // Getters
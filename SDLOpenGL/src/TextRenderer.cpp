@@ -23,11 +23,14 @@
  */
 
 #include "TextRenderer.h"
+#include "DynamicFont.h"
+#include "Utf8Iterator.h"
 #include "RendererSDLOpenGL.h"
 #include "FntLoader.h"
+#include "FrameStats.h"
+#include "Profiler.h"
 
-#include <locale>
-#include <codecvt>
+#include <algorithm>
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
@@ -37,7 +40,6 @@ Buffer* TextRenderer::vaoBuffer = nullptr;
 Buffer* TextRenderer::vertexBuffer = nullptr;
 
 TextRenderer::TextRenderer(void)
-: _currentTextureBind(-1)
 {	}
 
 TextRenderer::~TextRenderer(void)
@@ -50,34 +52,174 @@ void TextRenderer::add(Label *element)
 
 void TextRenderer::remove(Label *element)
 {
-	_renderQueue.push_back(element);
+	for (std::vector<Label*>::iterator iterator = _renderQueue.begin(); iterator != _renderQueue.end(); iterator++)
+	{
+		if (*iterator == element)
+		{
+			_renderQueue.erase(iterator);
+			return ;
+		}
+	}
 }
 
-void TextRenderer::render(const glm::mat4& orthographic)
+void TextRenderer::clear(void)
 {
-	prepare(orthographic);
+	_renderQueue.clear();
+}
 
-	static float x = 0;
-	static float y = 0;
+void TextRenderer::record(CommandBuffer& commands, const glm::mat4& orthographic)
+{
+	EXO_PROFILE_ZONE("TextRenderer::record");
+
+	commands.push(RenderCommandType::PUSH_PASS).object = "TextRenderer";
+	commands.push(RenderCommandType::BEGIN_TEXT).matrix = commands.pushMatrix(orthographic);
 
+	for (Batch& batch : _batches)
+	{
+		batch.vertices.clear();
+		batch.recorded = false;
+	}
+
+	// Labels sharing a font are drawn together, the color is per vertex
 	for (Label* label : _renderQueue)
 	{
-		int engineId = label->getFont()->getTexture()->getEngineId();
-		if (_currentTextureBind != engineId || _currentTextureBind == -1)
-			label->getFont()->getTexture()->bind();
+		Batch &batch = getBatch(commands, label->getFont().get());
+		Label::GlyphCache &cache = getGlyphCache(label);
+		glm::vec2 origin = label->getRealPosition() + label->getVirtualOffset() + label->getRelativeParentPosition();
+		size_t first = batch.vertices.size();
 
-		pTextShader->setVec3("textColor", label->getColor());
-		x = label->getRealPosition().x + label->getVirtualOffset().x + label->getRelativeParentPosition().x;
-		y = label->getRealPosition().y + label->getVirtualOffset().y + label->getRelativeParentPosition().y;
+		// Cached glyphs aren't looked up again, their pages are kept from eviction here
+		if (cache.pages)
+			label->getFont()->touch(cache.pages);
 
-		for (const auto& c : utf8ToUtf16(label->getText()))
-			renderCharacter(c, x, y, label);
+		// Moving a label doesn't lay it out again
+		batch.vertices.insert(batch.vertices.end(), cache.vertices.begin(), cache.vertices.end());
+		for (size_t i = first; i < batch.vertices.size(); i += TEXT_VERTEX_FLOATS)
+		{
+			batch.vertices[i] += origin.x;
+			batch.vertices[i + 1] += origin.y;
+		}
+		commands.getStats().glyphs += (uint32_t)(cache.vertices.size() / TEXT_GLYPH_FLOATS);
 	}
 
-	_currentTextureBind = -1;
+	for (Batch& batch : _batches)
+	{
+		if (batch.vertices.empty())
+			continue ;
+
+		const Font &font = *batch.font;
+		const float colors[8] = {
+			font.getOutlineColor().x, font.getOutlineColor().y, font.getOutlineColor().z, font.getOutlineColor().w,
+			font.getShadowColor().x, font.getShadowColor().y, font.getShadowColor().z, font.getShadowColor().w
+		};
+
+		RenderCommand &command = commands.push(RenderCommandType::TEXT);
+		command.texture = batch.texture;
+		command.first = commands.pushVertices(batch.vertices.data(), (unsigned int)batch.vertices.size());
+		command.count = (unsigned int)(batch.vertices.size() / TEXT_GLYPH_FLOATS);
+		command.param[0] = (int)font.getType();
+		command.param[1] = (int)commands.pushVertices(colors, 8);
+		command.value[0] = font.getDistanceRange();
+		command.value[1] = font.getOutlineWidth();
+		command.value[2] = font.getShadowOffset().x;
+		command.value[3] = font.getShadowOffset().y;
+	}
+
+	// Fonts no longer drawn are forgotten
+	_batches.erase(std::remove_if(_batches.begin(), _batches.end(), [](const Batch& batch) { return batch.vertices.empty(); }), _batches.end());
+
+	commands.push(RenderCommandType::POP_PASS);
+}
+
+void TextRenderer::execute(const RenderCommand& command, const CommandBuffer& commands)
+{
+	switch (command.type)
+	{
+		case RenderCommandType::BEGIN_TEXT:
+			prepare(commands.getMatrix(command.matrix));
+			break;
+		case RenderCommandType::GLYPHS:
+			DynamicFont::upload(command, commands);
+			break;
+		case RenderCommandType::TEXT:
+			renderText(command, commands);
+			break;
+		default: break;
+	}
 }
 
 // Private
+TextRenderer::Batch &TextRenderer::getBatch(CommandBuffer& commands, Font* font)
+{
+	Batch *batch = nullptr;
+
+	// A few fonts at most
+	for (Batch& candidate : _batches)
+		if (candidate.font == font)
+		{
+			batch = &candidate;
+			break ;
+		}
+	if (!batch)
+	{
+		_batches.push_back({font, 0, {}, false});
+		batch = &_batches.back();
+	}
+
+	// Once a frame, before its first label is laid out
+	if (!batch->recorded)
+	{
+		DynamicFont *dynamicFont = dynamic_cast<DynamicFont*>(font);
+
+		if (dynamicFont)
+			dynamicFont->update(commands);
+
+		// Resident since the last frame, a grown atlas, or another font at the same address
+		batch->texture = (GLuint)font->getTexture()->getEngineId();
+		batch->recorded = true;
+	}
+	return *batch;
+}
+
+Label::GlyphCache &TextRenderer::getGlyphCache(Label* label)
+{
+	Label::GlyphCache &cache = label->getGlyphCache();
+
+	// Glyphs rasterised or evicted since, the size of the label may have changed too
+	if (cache.generation != label->getFont()->getGeneration())
+	{
+		cache.valid = false;
+		label->updateGlyph();
+		cache.generation = label->getFont()->getGeneration();
+	}
+
+	const std::vector<TextLine> &lines = label->getLines();
+	if (cache.valid)
+		return cache;
+
+	// Line by line, as wrapped by the label
+	const std::string &text = label->getText();
+	cache.vertices.clear();
+	cache.pages = 0;
+	for (size_t line = 0; line < lines.size(); line++)
+	{
+		char32_t previous = 0;
+		float x = 0;
+		float y = line * TEXT_LINE_HEIGHT * label->getFontScale();
+
+		for (Utf8Iterator characters(text, lines[line].begin, lines[line].end); characters.hasNext();)
+		{
+			char32_t c = characters.next();
+
+			recordCharacter(cache.vertices, c, previous, x, y, label, label->getColor());
+			cache.pages |= label->getFont()->getPages(c);
+			previous = c;
+		}
+	}
+	cache.valid = true;
+	return cache;
+}
+
 void TextRenderer::prepare(const glm::mat4& orthographic)
 {
 	pTextShader->bind();
@@ -87,18 +229,14 @@ void TextRenderer::prepare(const glm::mat4& orthographic)
 	vaoBuffer->bind();
 }
 
-void TextRenderer::renderCharacter(const wchar_t c, float& x, float& y, Label* label)
+void TextRenderer::recordCharacter(std::vector<float>& vertices, const char32_t c, const char32_t previous, float& x, float y, Label* label, const glm::vec3& color)
 {
+	x += label->getFont()->getKerning(previous, c) * label->getFontScale();
 	if (c == ' ') // Space
-		x += 18 * label->getFontScale();
-	else if (c == '\n') // Return
-	{
-		x = label->getRealPosition().x + label->getVirtualOffset().x + label->getRelativeParentPosition().x;
-		y += 85 * label->getFontScale();
-	}
+		x += TEXT_SPACE_ADVANCE * label->getFontScale();
 	else
 	{
-		CharDescriptor ch = label->getFont()->getFont()->getCharacter(c);
+		const CharDescriptor &ch = label->getFont()->getCharacter(c);
 
 		float w = ch.width * label->getFontScale();
 		float h = ch.height * label->getFontScale();
@@ -107,26 +245,36 @@ void TextRenderer::renderCharacter(const wchar_t c, float& x, float& y, Label* l
 		float ypos = y + (ch.height + ch.yOffset) * label->getFontScale();
 
 		// Vertices for character
-		float vertices[24] = {
-			xpos,	 ypos - h,	ch.x,					ch.y,
-			xpos,	 ypos,		ch.x,					ch.yMaxTextureCoord,
-			xpos + w, ypos,		ch.xMaxTextureCoord,	ch.yMaxTextureCoord,
-
-			xpos,	 ypos - h,	ch.x,					ch.y,
-			xpos + w, ypos,		ch.xMaxTextureCoord,	ch.yMaxTextureCoord,
-			xpos + w, ypos - h,	ch.xMaxTextureCoord,	ch.y
+		const float glyph[TEXT_GLYPH_FLOATS] = {
+			xpos,	 ypos - h,	ch.x,					ch.y,					color.x, color.y, color.z,
+			xpos,	 ypos,		ch.x,					ch.yMaxTextureCoord,	color.x, color.y, color.z,
+			xpos + w, ypos,		ch.xMaxTextureCoord,	ch.yMaxTextureCoord,	color.x, color.y, color.z,
+
+			xpos,	 ypos - h,	ch.x,					ch.y,					color.x, color.y, color.z,
+			xpos + w, ypos,		ch.xMaxTextureCoord,	ch.yMaxTextureCoord,	color.x, color.y, color.z,
+			xpos + w, ypos - h,	ch.xMaxTextureCoord,	ch.y,					color.x, color.y, color.z
 		};
 
-		vertexBuffer->updateSubData(24, vertices);
-		vertexBuffer->bind();
+		vertices.insert(vertices.end(), glyph, glyph + TEXT_GLYPH_FLOATS);
 
-		GL_CALL(glDrawArrays(GL_TRIANGLES, 0, 6));
 		x += ch.xAdvance * label->getFontScale();
 	}
 }
 
-std::wstring TextRenderer::utf8ToUtf16(const std::string& utf8Str)
+void TextRenderer::renderText(const RenderCommand& command, const CommandBuffer& commands)
 {
-	std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> conv;
-	return conv.from_bytes(utf8Str);
+	const float *colors = commands.getVertices(command.param[1]);
+
+	Texture::bindBuffer(command.texture);
+	pTextShader->setInt("fontType", command.param[0]);
+	pTextShader->setFloat("distanceRange", command.value[0]);
+	pTextShader->setFloat("outlineWidth", command.value[1]);
+	pTextShader->setVec4("outlineColor", colors[0], colors[1], colors[2], colors[3]);
+	pTextShader->setVec4("shadowColor", colors[4], colors[5], colors[6], colors[7]);
+	pTextShader->setVec2("shadowOffset", command.value[2], command.value[3]);
+
+	// One upload and one draw for the whole font
+	vertexBuffer->stream(command.count * TEXT_GLYPH_FLOATS, commands.getVertices(command.first));
+	GL_CALL(glDrawArrays(GL_TRIANGLES, 0, command.count * 6));
+	FrameStats::draw(command.count * 2);
 }
@@ -23,12 +23,28 @@
  */
 
 #include "Texture.h"
+#include "RenderThread.h"
+#include "Profiler.h"
+#include "FrameStats.h"
+#include "TextureLoader.h"
+#include "TextureContainer.h"
+#include "GPUMemory.h"
+#include "SamplerCache.h"
+
+#include <algorithm>
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
 
-Texture::Texture(unsigned int width, unsigned int height, TextureFormat format, TextureFilter filter) :
-	_width(width), _height(height)
+GLuint Texture::placeholderId = 0;
+
+static GLuint	g_boundId = 0;
+static float	g_maxAnisotropy = -1.0f;	// Queried on first use
+
+Texture::Texture(unsigned int width, unsigned int height, TextureFormat format, TextureFilter filter, GLenum wrap) :
+	_width(width), _height(height), _wrap(wrap), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f), _resident(true),
+	_filter(isMipmapped(filter) ? TextureFilter::LINEAR : filter), // Render targets only have their base level
+	_category(MEMORY_TEXTURES), _bytes(0), _lastUsed(GPUMemory::getFrame()), _evicted(false)
 {
 	GLenum	textureFormat;
 
@@ -37,8 +53,6 @@ Texture::Texture(unsigned int width, unsigned int height, TextureFormat format,
 
 	GL_CALL(glBindTexture(GL_TEXTURE_2D, _id));
 
-	applyFilter(filter);
-
 	switch (format)
 	{
 		case RGBA:
@@ -50,13 +64,28 @@ Texture::Texture(unsigned int width, unsigned int height, TextureFormat format,
 		case DEPTH:
 			textureFormat = GL_DEPTH_COMPONENT;
 			break;
+		case RED:
+			textureFormat = GL_RED;
+			break;
 	}
 
-	GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, textureFormat, width, height, 0, textureFormat, GL_UNSIGNED_BYTE, NULL));
+	allocateStorage(GL_TEXTURE_2D, 1, getInternalFormat(textureFormat), width, height);
+	applySampler();
+	setAllocated((uint64_t)width * height * (format == RED ? 1 : format == RGB ? 3 : 4));
 }
 
-Texture::Texture(const std::string& filePath, TextureFilter filter)
+Texture::Texture(const std::string& filePath, TextureFilter filter) :
+	_wrap(GL_REPEAT), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f), _resident(true),
+	_filePath(filePath), _filter(filter), _category(MEMORY_TEXTURES), _bytes(0), _lastUsed(GPUMemory::getFrame()), _evicted(false)
 {
+	EXO_PROFILE_ZONE("Texture::load");
+
+	if (TextureContainer::isContainer(filePath) && loadContainer(filePath, filter))
+	{
+		GPUMemory::track(this);
+		return ;
+	}
+
 	SDL_Surface*	image = IMG_Load(filePath.c_str());
 	GLenum			textureFormat;
 
@@ -70,8 +99,6 @@ Texture::Texture(const std::string& filePath, TextureFilter filter)
 
 	GL_CALL(glBindTexture(GL_TEXTURE_2D, _id));
 
-	applyFilter(filter);
-
 	textureFormat = getFormat(image->format->BytesPerPixel);
 
 	switch (textureFormat)
@@ -87,31 +114,62 @@ Texture::Texture(const std::string& filePath, TextureFilter filter)
 			break;
 	}
 
-	GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, textureFormat, image->w, image->h, 0, textureFormat, GL_UNSIGNED_BYTE, image->pixels));
+	allocateStorage(GL_TEXTURE_2D, isMipmapped(filter) ? getLevelCount(image->w, image->h) : 1, getInternalFormat(textureFormat), image->w, image->h);
+	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, image->w, image->h, textureFormat, GL_UNSIGNED_BYTE, image->pixels));
+	if (isMipmapped(filter))
+	{
+		GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+	}
+	FrameStats::uploadTexture((uint64_t)image->h * image->pitch);
 
 	_width = image->w;
 	_height = image->h;
+	applySampler();
+	setAllocated(GPUMemory::getSize((uint64_t)image->w * image->h * image->format->BytesPerPixel, isMipmapped(filter)));
+	GPUMemory::track(this);
 
 	// Free texture
 	if (image)
 		SDL_FreeSurface(image);
 }
 
-Texture::~Texture(void)
+Texture::Texture(const std::shared_ptr<TextureRequest> &request) :
+	_id(0), _format(RGBA), _width(0), _height(0), _wrap(GL_REPEAT), _lodBias(0.0f), _minLod(-1000.0f), _maxLod(1000.0f), _resident(false), _pRequest(request),
+	_filePath(request->filePath), _filter(request->filter), _category(MEMORY_TEXTURES), _bytes(0), _lastUsed(GPUMemory::getFrame()), _evicted(false)
 {
-	glDeleteTextures(1, &_id);
+	GPUMemory::track(this);
 }
 
-void Texture::bind(int unit) const
+Texture::~Texture(void)
 {
-	static GLuint	lastId = 0;
+	GLuint	id;
+
+	// No eviction runs past this point
+	if (!_filePath.empty())
+		GPUMemory::untrack(this);
 
-	if (_id != lastId)
+	// Detach from a load in flight, the upload then drops its result
+	if (_pRequest)
 	{
-		GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
-		GL_CALL(glBindTexture(GL_TEXTURE_2D, _id));
-		lastId = _id;
+		std::lock_guard<std::mutex> lock(_pRequest->mutex);
+		_pRequest->texture = nullptr;
 	}
+
+	if (!_resident)
+		return ;
+	id = _id;
+	GPUMemory::release(_category, _bytes);
+
+	// May be released by the game thread while the render thread owns the context
+	RenderThread::post([id]() {
+		SamplerCache::remove(id);
+		glDeleteTextures(1, &id);
+	});
+}
+
+void Texture::bind(int unit) const
+{
+	bindBuffer(getBuffer(), unit);
 }
 
 void Texture::unbind(void) const
@@ -124,12 +182,19 @@ void Texture::unbind(void) const
 // Getters
 int Texture::getEngineId(void) const
 {
-	return _id;
+	return getBuffer();
 }
 
 GLuint Texture::getBuffer(void) const
 {
-	return _id;
+	_lastUsed.store(GPUMemory::getFrame(), std::memory_order_relaxed);
+	if (_resident.load(std::memory_order_acquire))
+		return _id;
+
+	// Evicted, loaded again in the background while the placeholder is drawn
+	if (_evicted.exchange(false) && !TextureLoader::reload(const_cast<Texture*>(this)))
+		_evicted.store(true);
+	return placeholderId;
 }
 
 TextureFormat	Texture::getFormat(void) const
@@ -137,20 +202,107 @@ TextureFormat	Texture::getFormat(void) const
 	return (_format);
 }
 
+bool Texture::isResident(void) const
+{
+	return _resident.load(std::memory_order_acquire);
+}
+
+uint64_t Texture::getAllocatedBytes(void) const
+{
+	return _bytes.load(std::memory_order_relaxed);
+}
+
+// Setters
+void Texture::setLodBias(float bias)
+{
+	// On the GL thread, like the asynchronous upload which applies it once resident
+	RenderThread::invoke([this, bias]() {
+		_lodBias = bias;
+		applySampler();
+	});
+}
+
+void Texture::setLodRange(float minLod, float maxLod)
+{
+	RenderThread::invoke([this, minLod, maxLod]() {
+		_minLod = minLod;
+		_maxLod = maxLod;
+		applySampler();
+	});
+}
+
+void Texture::setCategory(MemoryCategory category)
+{
+	// Nothing is allocated while evicted or loading
+	GPUMemory::release(_category, _bytes);
+	GPUMemory::allocate(category, _bytes);
+	_category = category;
+}
+
 // Private
-void Texture::applyFilter(const TextureFilter& filter)
+bool Texture::loadContainer(const std::string& filePath, TextureFilter filter)
 {
-	switch (filter)
+	TextureContainer	container;
+
+	// Falls back to the default texture like a missing image would
+	try
 	{
-		case TextureFilter::NEAREST:
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
-			break;
-		default:
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-			GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-			break;
+		container.load(filePath);
 	}
+	catch (const std::exception&)
+	{
+		return false;
+	}
+	if (container.isCompressed() && !TextureContainer::isFormatSupported(container.getFormat()) && !container.decompress())
+		return false;
+
+	GL_CALL(glGenTextures(1, &_id));
+
+	GL_CALL(glBindTexture(GL_TEXTURE_2D, _id));
+
+	FrameStats::uploadTexture(container.upload(GL_TEXTURE_2D, isMipmapped(filter)));
+	setAllocated(container.getAllocatedSize(isMipmapped(filter)));
+	applySampler();
+
+	_format = container.getFormat() == GL_RGB8 ? RGB : RGBA;
+	_width = container.getWidth();
+	_height = container.getHeight();
+	return true;
+}
+
+void Texture::applySampler(void) const
+{
+	// Uploaded later, the upload applies it
+	if (!_resident.load(std::memory_order_acquire))
+		return ;
+
+	GL_CALL(glBindTexture(GL_TEXTURE_2D, _id));
+	SamplerCache::apply(_id, GL_TEXTURE_2D, {_filter, _wrap, _lodBias, _minLod, _maxLod});
+	resetBinding();
+}
+
+void Texture::setAllocated(uint64_t bytes)
+{
+	GPUMemory::release(_category, _bytes);
+	GPUMemory::allocate(_category, bytes);
+	_bytes = bytes;
+}
+
+uint64_t Texture::evict(void)
+{
+	GLuint		id = _id;
+	uint64_t	bytes = _bytes;
+
+	_evicted.store(true);
+	_resident.store(false, std::memory_order_release);
+	setAllocated(0);
+
+	// Recorded frames may still sample it
+	RenderThread::post([id]() {
+		SamplerCache::remove(id);
+		glDeleteTextures(1, &id);
+	});
+	return bytes;
 }
 
 // Private
@@ -196,6 +348,148 @@ GLenum Texture::getFormat(const unsigned int& format)
 	}
 }
 
+void Texture::bindBuffer(GLuint id, int unit)
+{
+	if (id != g_boundId)
+	{
+		GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
+		GL_CALL(glBindTexture(GL_TEXTURE_2D, id));
+		FrameStats::current.textureBinds++;
+		g_boundId = id;
+	}
+	SamplerCache::bind(id, unit);
+}
+
+void Texture::resetBinding(void)
+{
+	// Matches no texture, the next bindBuffer() always binds
+	g_boundId = (GLuint)-1;
+}
+
+void Texture::applyFilter(const TextureFilter& filter, GLenum target)
+{
+	GL_CALL(glTexParameteri(target, GL_TEXTURE_MIN_FILTER, getMinFilter(filter)));
+	GL_CALL(glTexParameteri(target, GL_TEXTURE_MAG_FILTER, getMagFilter(filter)));
+	if (filter == TextureFilter::ANISOTROPIC && getAnisotropy() > 1.0f)
+		GL_CALL(glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, getAnisotropy()));
+}
+
+bool Texture::isMipmapped(const TextureFilter& filter)
+{
+	return filter == TextureFilter::TRILINEAR || filter == TextureFilter::ANISOTROPIC;
+}
+
+GLint Texture::getMinFilter(const TextureFilter& filter)
+{
+	switch (filter)
+	{
+		case TextureFilter::NEAREST:
+			return GL_NEAREST;
+		case TextureFilter::TRILINEAR:
+		case TextureFilter::ANISOTROPIC:
+			return GL_LINEAR_MIPMAP_LINEAR;
+		default:
+			return GL_LINEAR;
+	}
+}
+
+GLint Texture::getMagFilter(const TextureFilter& filter)
+{
+	return filter == TextureFilter::NEAREST ? GL_NEAREST : GL_LINEAR;
+}
+
+float Texture::getAnisotropy(void)
+{
+	if (g_maxAnisotropy < 0.0f)
+	{
+		g_maxAnisotropy = 1.0f;
+		if (GLEW_VERSION_4_6 || GLEW_ARB_texture_filter_anisotropic || GLEW_EXT_texture_filter_anisotropic)
+		{
+			GL_CALL(glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &g_maxAnisotropy));
+		}
+	}
+	return std::min(g_maxAnisotropy, TEXTURE_MAX_ANISOTROPY);
+}
+
+void Texture::allocateStorage(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei layers)
+{
+	GLenum	format, type = GL_UNSIGNED_BYTE;
+
+	if (hasImmutableStorage())
+	{
+		if (target == GL_TEXTURE_2D_ARRAY)
+		{
+			GL_CALL(glTexStorage3D(target, levels, internalFormat, width, height, layers));
+		}
+		else
+		{
+			GL_CALL(glTexStorage2D(target, levels, internalFormat, width, height));
+		}
+		return ;
+	}
+
+	switch (internalFormat)
+	{
+		case GL_RGB8:
+		case GL_SRGB8:
+			format = GL_RGB;
+			break;
+		case GL_DEPTH_COMPONENT24:
+			format = GL_DEPTH_COMPONENT;
+			type = GL_UNSIGNED_INT;
+			break;
+		default:
+			format = GL_RGBA;
+			break;
+	}
+
+	// Same layout as glTexStorage, the sampling stops at the last level allocated
+	for (GLsizei level = 0; level < levels; level++)
+	{
+		GLsizei	levelWidth = std::max(width >> level, 1), levelHeight = std::max(height >> level, 1);
+
+		if (target == GL_TEXTURE_2D_ARRAY)
+		{
+			GL_CALL(glTexImage3D(target, level, internalFormat, levelWidth, levelHeight, layers, 0, format, type, NULL));
+		}
+		else
+		{
+			GL_CALL(glTexImage2D(target, level, internalFormat, levelWidth, levelHeight, 0, format, type, NULL));
+		}
+	}
+	GL_CALL(glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, levels - 1));
+}
+
+bool Texture::hasImmutableStorage(void)
+{
+	return GLEW_VERSION_4_2 || GLEW_ARB_texture_storage;
+}
+
+GLsizei Texture::getLevelCount(GLsizei width, GLsizei height)
+{
+	GLsizei	levels = 1;
+
+	while ((width | height) >> levels)
+		levels++;
+	return levels;
+}
+
+GLenum Texture::getInternalFormat(GLenum format)
+{
+	switch (format)
+	{
+		case GL_RGB:
+		case GL_BGR:
+			return GL_RGB8;
+		case GL_RED:
+			return GL_R8;
+		case GL_DEPTH_COMPONENT:
+			return GL_DEPTH_COMPONENT24;
+		default:
+			return GL_RGBA8;
+	}
+}
+
 int	 Texture::getWidth(void) const
 {
 	return (_width);
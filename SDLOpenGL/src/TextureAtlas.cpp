@@ -0,0 +1,135 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "TextureAtlas.h"
+#include "AtlasRegion.h"
+#include "RenderThread.h"
+#include "FrameStats.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+
+TextureAtlas::TextureAtlas(int pageSize, int padding, TextureFilter filter)
+: _pageSize(pageSize), _padding(std::max(padding, 0)), _filter(filter)
+{	}
+
+TextureAtlas::~TextureAtlas(void)
+{	}
+
+std::shared_ptr<ITexture> TextureAtlas::add(const std::string& filePath)
+{
+	EXO_PROFILE_ZONE("TextureAtlas::add");
+
+	SDL_Surface	*loaded = IMG_Load(filePath.c_str());
+	SDL_Surface	*image;
+	int			x, y;
+
+	if (!loaded)
+	{
+		loaded = Texture::generateDefaultTexture();
+		SDL_FillRect(loaded, NULL, SDL_MapRGB(loaded->format, 255, 0, 255));
+	}
+	image = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(loaded);
+	if (!image)
+		throw (std::runtime_error("cannot convert " + filePath));
+
+	if (image->w + 2 * _padding > _pageSize || image->h + 2 * _padding > _pageSize)
+	{
+		SDL_FreeSurface(image);
+		throw (std::invalid_argument(filePath + " doesn't fit in a " + std::to_string(_pageSize) + "x" + std::to_string(_pageSize) + " atlas page"));
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	Page *page = nullptr;
+
+	// First page with room, a new one otherwise
+	for (Page &candidate : _pages)
+	{
+		if (candidate.packer.insert(image->w + 2 * _padding, image->h + 2 * _padding, x, y))
+		{
+			page = &candidate;
+			break ;
+		}
+	}
+	if (!page)
+	{
+		Texture	*texture;
+
+		RenderThread::invoke([this, &texture]() { texture = new Texture(_pageSize, _pageSize, RGBA, _filter); });
+		_pages.push_back({std::shared_ptr<Texture>(texture), RectPacker(_pageSize, _pageSize)});
+		page = &_pages.back();
+		page->packer.insert(image->w + 2 * _padding, image->h + 2 * _padding, x, y);
+	}
+
+	upload(*page, x, y, image);
+
+	std::shared_ptr<ITexture> region = std::make_shared<AtlasRegion>(page->texture, x + _padding, y + _padding, image->w, image->h);
+	SDL_FreeSurface(image);
+	return region;
+}
+
+// Getters
+size_t TextureAtlas::getPageCount(void) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pages.size();
+}
+
+std::shared_ptr<ITexture> TextureAtlas::getPage(size_t index) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pages.at(index).texture;
+}
+
+// Private
+void TextureAtlas::upload(const Page &page, int x, int y, SDL_Surface *image)
+{
+	int						width = image->w + 2 * _padding;
+	int						height = image->h + 2 * _padding;
+	std::vector<uint32_t>	pixels((size_t)width * height);
+	GLuint					id = page.texture->getBuffer();
+
+	// The padding repeats the nearest edge pixel
+	for (int row = 0; row < height; row++)
+	{
+		int			sourceRow = std::min(std::max(row - _padding, 0), image->h - 1);
+		uint32_t	*source = (uint32_t*)((unsigned char*)image->pixels + sourceRow * image->pitch);
+
+		for (int column = 0; column < width; column++)
+			pixels[(size_t)row * width + column] = source[std::min(std::max(column - _padding, 0), image->w - 1)];
+	}
+
+	RenderThread::invoke([&]() {
+		GL_CALL(glBindTexture(GL_TEXTURE_2D, id));
+		GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+		Texture::resetBinding();
+	});
+	FrameStats::uploadTexture((uint64_t)width * height * 4);
+}
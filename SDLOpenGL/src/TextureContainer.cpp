@@ -0,0 +1,1064 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "TextureContainer.h"
+#include "Profiler.h"
+#include "Texture.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+using namespace ExoRendererSDLOpenGL;
+
+namespace
+{
+
+struct FormatInfo
+{
+	GLenum			format;
+	unsigned int	blockWidth;
+	unsigned int	blockHeight;
+	unsigned int	blockBytes;
+	bool			compressed;
+};
+
+const FormatInfo	g_formats[] = {
+	{GL_RGBA8,										1, 1, 4, false},
+	{GL_SRGB8_ALPHA8,								1, 1, 4, false},
+	{GL_RGB8,										1, 1, 3, false},
+	// BC1 - BC3
+	{GL_COMPRESSED_RGB_S3TC_DXT1_EXT,				4, 4, 8, true},
+	{GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,				4, 4, 8, true},
+	{GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,				4, 4, 16, true},
+	{GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,				4, 4, 16, true},
+	{GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,				4, 4, 8, true},
+	{GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,		4, 4, 8, true},
+	{GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,		4, 4, 16, true},
+	{GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,		4, 4, 16, true},
+	// BC4, BC5
+	{GL_COMPRESSED_RED_RGTC1,						4, 4, 8, true},
+	{GL_COMPRESSED_SIGNED_RED_RGTC1,				4, 4, 8, true},
+	{GL_COMPRESSED_RG_RGTC2,						4, 4, 16, true},
+	{GL_COMPRESSED_SIGNED_RG_RGTC2,					4, 4, 16, true},
+	// BC6H, BC7
+	{GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,			4, 4, 16, true},
+	{GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,			4, 4, 16, true},
+	{GL_COMPRESSED_RGBA_BPTC_UNORM,					4, 4, 16, true},
+	{GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,			4, 4, 16, true},
+	// ETC2
+	{GL_COMPRESSED_RGB8_ETC2,						4, 4, 8, true},
+	{GL_COMPRESSED_SRGB8_ETC2,						4, 4, 8, true},
+	{GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,	4, 4, 8, true},
+	{GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2,	4, 4, 8, true},
+	{GL_COMPRESSED_RGBA8_ETC2_EAC,					4, 4, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,			4, 4, 16, true},
+	// ASTC, every block is 16 bytes
+	{GL_COMPRESSED_RGBA_ASTC_4x4_KHR,				4, 4, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_5x4_KHR,				5, 4, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_5x5_KHR,				5, 5, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_6x5_KHR,				6, 5, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_6x6_KHR,				6, 6, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_8x5_KHR,				8, 5, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_8x6_KHR,				8, 6, 16, true},
+	{GL_COMPRESSED_RGBA_ASTC_8x8_KHR,				8, 8, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR,		4, 4, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR,		5, 4, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR,		5, 5, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR,		6, 5, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR,		6, 6, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR,		8, 5, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR,		8, 6, 16, true},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR,		8, 8, 16, true}
+};
+
+// VkFormat (KTX2) to GL
+const GLenum	g_vulkanFormats[][2] = {
+	{37, GL_RGBA8},			{43, GL_SRGB8_ALPHA8},
+	{131, GL_COMPRESSED_RGB_S3TC_DXT1_EXT},			{132, GL_COMPRESSED_SRGB_S3TC_DXT1_EXT},
+	{133, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT},		{134, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT},
+	{135, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT},		{136, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT},
+	{137, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT},		{138, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT},
+	{139, GL_COMPRESSED_RED_RGTC1},					{140, GL_COMPRESSED_SIGNED_RED_RGTC1},
+	{141, GL_COMPRESSED_RG_RGTC2},					{142, GL_COMPRESSED_SIGNED_RG_RGTC2},
+	{143, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT},	{144, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT},
+	{145, GL_COMPRESSED_RGBA_BPTC_UNORM},			{146, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM},
+	{147, GL_COMPRESSED_RGB8_ETC2},					{148, GL_COMPRESSED_SRGB8_ETC2},
+	{149, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2},	{150, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2},
+	{151, GL_COMPRESSED_RGBA8_ETC2_EAC},			{152, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC},
+	{157, GL_COMPRESSED_RGBA_ASTC_4x4_KHR},			{158, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR},
+	{159, GL_COMPRESSED_RGBA_ASTC_5x4_KHR},			{160, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR},
+	{161, GL_COMPRESSED_RGBA_ASTC_5x5_KHR},			{162, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR},
+	{163, GL_COMPRESSED_RGBA_ASTC_6x5_KHR},			{164, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR},
+	{165, GL_COMPRESSED_RGBA_ASTC_6x6_KHR},			{166, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR},
+	{167, GL_COMPRESSED_RGBA_ASTC_8x5_KHR},			{168, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR},
+	{169, GL_COMPRESSED_RGBA_ASTC_8x6_KHR},			{170, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR},
+	{171, GL_COMPRESSED_RGBA_ASTC_8x8_KHR},			{172, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR}
+};
+
+// DXGI_FORMAT (DDS DX10 header) to GL, B8G8R8A8 is swizzled on load
+const GLenum	g_dxgiFormats[][2] = {
+	{28, GL_RGBA8},									{29, GL_SRGB8_ALPHA8},
+	{71, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT},			{72, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT},
+	{74, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT},			{75, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT},
+	{77, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT},			{78, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT},
+	{80, GL_COMPRESSED_RED_RGTC1},					{81, GL_COMPRESSED_SIGNED_RED_RGTC1},
+	{83, GL_COMPRESSED_RG_RGTC2},					{84, GL_COMPRESSED_SIGNED_RG_RGTC2},
+	{87, GL_RGBA8},									{91, GL_SRGB8_ALPHA8},
+	{95, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT},	{96, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT},
+	{98, GL_COMPRESSED_RGBA_BPTC_UNORM},			{99, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM}
+};
+
+const unsigned char	g_ktxIdentifier[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+const unsigned char	g_ktx2Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+inline uint32_t	read32(const unsigned char *data)
+{
+	return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+inline uint64_t	read64(const unsigned char *data)
+{
+	return (uint64_t)read32(data) | ((uint64_t)read32(data + 4) << 32);
+}
+
+inline uint32_t	fourCC(const char *code)
+{
+	return read32((const unsigned char*)code);
+}
+
+inline void	write32(std::vector<unsigned char> &data, uint32_t value)
+{
+	for (int i = 0; i < 4; i++)
+		data.push_back((unsigned char)(value >> (i * 8)));
+}
+
+inline void	write64(std::vector<unsigned char> &data, uint64_t value)
+{
+	write32(data, (uint32_t)value);
+	write32(data, (uint32_t)(value >> 32));
+}
+
+inline uint64_t	align(uint64_t offset)
+{
+	return (offset + TEXTURE_FILE_ALIGNMENT - 1) & ~(uint64_t)(TEXTURE_FILE_ALIGNMENT - 1);
+}
+
+void	need(uint64_t offset, uint64_t length, size_t size)
+{
+	if (offset > size || length > size - offset)
+		throw (std::runtime_error("truncated texture file"));
+}
+
+GLenum	findFormat(const GLenum table[][2], size_t count, uint32_t id)
+{
+	for (size_t i = 0; i < count; i++)
+		if (table[i][0] == id)
+			return table[i][1];
+	return 0;
+}
+
+std::string	formatName(GLenum format)
+{
+	char	name[16];
+
+	std::snprintf(name, sizeof(name), "0x%04X", (unsigned int)format);
+	return name;
+}
+
+// BCn blocks, one 4x4 block to 16 RGBA pixels
+void	decodeColorBlock(const unsigned char *block, unsigned char *pixels, bool punchThrough)
+{
+	unsigned char	colors[4][4];
+	uint16_t		endpoints[2] = {(uint16_t)(block[0] | (block[1] << 8)), (uint16_t)(block[2] | (block[3] << 8))};
+	uint32_t		indices = read32(block + 4);
+
+	for (int i = 0; i < 2; i++)
+	{
+		unsigned int r = (endpoints[i] >> 11) & 31, g = (endpoints[i] >> 5) & 63, b = endpoints[i] & 31;
+
+		colors[i][0] = (unsigned char)((r << 3) | (r >> 2));
+		colors[i][1] = (unsigned char)((g << 2) | (g >> 4));
+		colors[i][2] = (unsigned char)((b << 3) | (b >> 2));
+		colors[i][3] = 255;
+	}
+
+	for (int c = 0; c < 3; c++)
+	{
+		if (endpoints[0] > endpoints[1] || !punchThrough)
+		{
+			colors[2][c] = (unsigned char)((2 * colors[0][c] + colors[1][c]) / 3);
+			colors[3][c] = (unsigned char)((colors[0][c] + 2 * colors[1][c]) / 3);
+		}
+		else
+		{
+			colors[2][c] = (unsigned char)((colors[0][c] + colors[1][c]) / 2);
+			colors[3][c] = 0;
+		}
+	}
+	colors[2][3] = 255;
+	colors[3][3] = (endpoints[0] > endpoints[1] || !punchThrough) ? 255 : 0;
+
+	for (int i = 0; i < 16; i++)
+		std::memcpy(pixels + i * 4, colors[(indices >> (i * 2)) & 3], 4);
+}
+
+// BC3 alpha, BC4 and BC5 channels
+void	decodeChannelBlock(const unsigned char *block, unsigned char *pixels, int channel)
+{
+	unsigned int	values[8];
+	uint64_t		indices = 0;
+
+	values[0] = block[0];
+	values[1] = block[1];
+	if (values[0] > values[1])
+	{
+		for (int i = 1; i < 7; i++)
+			values[i + 1] = ((7 - i) * values[0] + i * values[1]) / 7;
+	}
+	else
+	{
+		for (int i = 1; i < 5; i++)
+			values[i + 1] = ((5 - i) * values[0] + i * values[1]) / 5;
+		values[6] = 0;
+		values[7] = 255;
+	}
+
+	for (int i = 0; i < 6; i++)
+		indices |= (uint64_t)block[2 + i] << (i * 8);
+	for (int i = 0; i < 16; i++)
+		pixels[i * 4 + channel] = (unsigned char)values[(indices >> (i * 3)) & 7];
+}
+
+// BC2 alpha, 4 bits per pixel
+void	decodeExplicitAlphaBlock(const unsigned char *block, unsigned char *pixels)
+{
+	for (int i = 0; i < 16; i++)
+		pixels[i * 4 + 3] = (unsigned char)(((block[i / 2] >> ((i & 1) * 4)) & 0xF) * 17);
+}
+
+}
+
+TextureContainer::TextureContainer(void)
+: _format(0), _pixelFormat(GL_RGBA), _compressed(false), _blockWidth(1), _blockHeight(1), _blockBytes(4), _width(0), _height(0), _layers(0)
+{ }
+
+TextureContainer::~TextureContainer(void)
+{ }
+
+void TextureContainer::load(const std::string &filePath)
+{
+	EXO_PROFILE_ZONE("TextureContainer::load");
+
+	std::shared_ptr<ExoRenderer::MappedFile>	file = std::make_shared<ExoRenderer::MappedFile>(filePath);
+
+	// Levels laid out as GL reads them stay in the mapping, the rest is copied out
+	parse(file->getData(), file->getSize());
+	_pFile = file;
+}
+
+void TextureContainer::load(const unsigned char *data, size_t size)
+{
+	parse(data, size);
+	own();
+}
+
+void TextureContainer::setImage(GLenum internalFormat, GLenum pixelFormat, unsigned int width, unsigned int height, const unsigned char *pixels, size_t pitch)
+{
+	size_t	row;
+
+	setFormat(internalFormat);
+	if (_compressed)
+		throw (std::invalid_argument("images can't be set from compressed pixels"));
+	_pixelFormat = pixelFormat;
+	_width = width;
+	_height = height;
+	_layers = 1;
+	_pFile.reset();
+
+	row = (size_t)width * _blockBytes;
+	_storage.assign(1, std::vector<unsigned char>(row * height));
+	for (unsigned int y = 0; y < height; y++)
+		std::memcpy(_storage[0].data() + y * row, pixels + y * pitch, row);
+	_levels.assign(1, _storage[0].data());
+}
+
+void TextureContainer::generateMipmaps(void)
+{
+	EXO_PROFILE_ZONE("TextureContainer::generateMipmaps");
+
+	unsigned int	channels = _blockBytes;
+
+	if (_compressed || _levels.size() != 1)
+		throw (std::logic_error("mipmaps are generated from a single uncompressed level"));
+	own();
+
+	for (unsigned int level = 1; (_width >> (level - 1)) > 1 || (_height >> (level - 1)) > 1; level++)
+	{
+		unsigned int				sourceWidth = std::max(_width >> (level - 1), 1u);
+		unsigned int				sourceHeight = std::max(_height >> (level - 1), 1u);
+		unsigned int				width = std::max(_width >> level, 1u);
+		unsigned int				height = std::max(_height >> level, 1u);
+		std::vector<unsigned char>	pixels((size_t)width * height * channels * _layers);
+
+		for (unsigned int layer = 0; layer < _layers; layer++)
+		{
+			downsample(_storage[level - 1].data() + (size_t)layer * sourceWidth * sourceHeight * channels, sourceWidth, sourceHeight, channels,
+				pixels.data() + (size_t)layer * width * height * channels);
+		}
+		_storage.push_back(std::move(pixels));
+	}
+
+	_levels.resize(_storage.size());
+	for (size_t level = 0; level < _storage.size(); level++)
+		_levels[level] = _storage[level].data();
+}
+
+void TextureContainer::downsample(const unsigned char *source, unsigned int sourceWidth, unsigned int sourceHeight, unsigned int channels, unsigned char *destination)
+{
+	unsigned int	width = std::max(sourceWidth >> 1, 1u);
+	unsigned int	height = std::max(sourceHeight >> 1, 1u);
+
+	for (unsigned int y = 0; y < height; y++)
+	{
+		unsigned int y0 = std::min(y * 2, sourceHeight - 1), y1 = std::min(y * 2 + 1, sourceHeight - 1);
+
+		for (unsigned int x = 0; x < width; x++)
+		{
+			unsigned int x0 = std::min(x * 2, sourceWidth - 1), x1 = std::min(x * 2 + 1, sourceWidth - 1);
+
+			for (unsigned int c = 0; c < channels; c++)
+			{
+				unsigned int sum = source[((size_t)y0 * sourceWidth + x0) * channels + c]
+					+ source[((size_t)y0 * sourceWidth + x1) * channels + c]
+					+ source[((size_t)y1 * sourceWidth + x0) * channels + c]
+					+ source[((size_t)y1 * sourceWidth + x1) * channels + c];
+
+				destination[((size_t)y * width + x) * channels + c] = (unsigned char)((sum + 2) / 4);
+			}
+		}
+	}
+}
+
+void TextureContainer::save(const std::string &filePath) const
+{
+	std::ofstream				file(filePath, std::ios::binary | std::ios::trunc);
+	std::vector<unsigned char>	header;
+	uint64_t					offset;
+	uint32_t					fields[10] = {
+		TEXTURE_FILE_MAGIC, TEXTURE_FILE_VERSION, _format, _compressed ? 0u : _pixelFormat, _compressed ? 0u : (uint32_t)GL_UNSIGNED_BYTE,
+		_width, _height, _layers, (uint32_t)_levels.size(), 0
+	};
+
+	if (!file)
+		throw (std::runtime_error("cannot open " + filePath));
+
+	for (uint32_t field : fields)
+		write32(header, field);
+	offset = align(40 + _levels.size() * 16);
+	for (unsigned int level = 0; level < _levels.size(); level++)
+	{
+		uint64_t size = getLevelSize(level) * _layers;
+
+		write64(header, offset);
+		write64(header, size);
+		offset = align(offset + size);
+	}
+	header.resize(align(header.size()), 0);
+	file.write((const char*)header.data(), header.size());
+
+	for (unsigned int level = 0; level < _levels.size(); level++)
+	{
+		size_t			size = getLevelSize(level) * _layers;
+		const char		padding[TEXTURE_FILE_ALIGNMENT] = {0};
+
+		file.write((const char*)_levels[level], size);
+		file.write(padding, align(size) - size);
+	}
+	if (!file)
+		throw (std::runtime_error("cannot write " + filePath));
+}
+
+// Private
+void TextureContainer::parse(const unsigned char *data, size_t size)
+{
+	_levels.clear();
+	_storage.clear();
+	_pFile.reset();
+
+	if (size >= 4 && read32(data) == TEXTURE_FILE_MAGIC)
+		loadETEX(data, size);
+	else if (size >= 12 && std::memcmp(data, g_ktxIdentifier, 12) == 0)
+		loadKTX(data, size);
+	else if (size >= 12 && std::memcmp(data, g_ktx2Identifier, 12) == 0)
+		loadKTX2(data, size);
+	else if (size >= 4 && std::memcmp(data, "DDS ", 4) == 0)
+		loadDDS(data, size);
+	else
+		throw (std::runtime_error("not an ETEX, KTX, KTX2 or DDS file"));
+}
+
+void TextureContainer::own(void)
+{
+	// Already copied, or decoded
+	if (!_pFile)
+		return ;
+
+	_storage.resize(_levels.size());
+	for (size_t level = 0; level < _levels.size(); level++)
+	{
+		_storage[level].assign(_levels[level], _levels[level] + getLevelSize((unsigned int)level) * _layers);
+		_levels[level] = _storage[level].data();
+	}
+	_pFile.reset();
+}
+
+void TextureContainer::appendLayers(const TextureContainer &other)
+{
+	if (_layers == 0)
+	{
+		// Shares the other's mapping, copied on the next append
+		setFormat(other._format);
+		_pixelFormat = other._pixelFormat;
+		_width = other._width;
+		_height = other._height;
+		_layers = other._layers;
+		_levels = other._levels;
+		_storage = other._storage;
+		_pFile = other._pFile;
+		for (size_t level = 0; level < _storage.size(); level++)
+			_levels[level] = _storage[level].data();
+		return ;
+	}
+
+	if (other._format != _format || other._pixelFormat != _pixelFormat || other._width != _width || other._height != _height || other._levels.size() != _levels.size())
+		throw (std::invalid_argument("texture layers differ in format, size or mip levels"));
+
+	own();
+	for (unsigned int level = 0; level < _levels.size(); level++)
+	{
+		_storage[level].insert(_storage[level].end(), other._levels[level], other._levels[level] + other.getLevelSize(level) * other._layers);
+		_levels[level] = _storage[level].data();
+	}
+	_layers += other._layers;
+}
+
+bool TextureContainer::decompress(void)
+{
+	EXO_PROFILE_ZONE("TextureContainer::decompress");
+
+	bool	srgb = false;
+	int		kind;	// 1: BC1, 2: BC2, 3: BC3, 4: BC4, 5: BC5
+
+	switch (_format)
+	{
+		case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+			srgb = true;
+			// fallthrough
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+			kind = 1;
+			break;
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+			srgb = true;
+			// fallthrough
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+			kind = 2;
+			break;
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+			srgb = true;
+			// fallthrough
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+			kind = 3;
+			break;
+		case GL_COMPRESSED_RED_RGTC1:
+			kind = 4;
+			break;
+		case GL_COMPRESSED_RG_RGTC2:
+			kind = 5;
+			break;
+		default:
+			return false;
+	}
+
+	_storage.resize(_levels.size());
+	for (unsigned int level = 0; level < _levels.size(); level++)
+	{
+		unsigned int				width = std::max(_width >> level, 1u);
+		unsigned int				height = std::max(_height >> level, 1u);
+		unsigned int				blocksX = (width + 3) / 4;
+		unsigned int				blocksY = (height + 3) / 4;
+		size_t						levelSize = getLevelSize(level);
+		std::vector<unsigned char>	pixels((size_t)width * height * 4 * _layers);
+
+		for (unsigned int layer = 0; layer < _layers; layer++)
+		{
+			const unsigned char	*source = _levels[level] + layer * levelSize;
+			unsigned char		*destination = pixels.data() + (size_t)layer * width * height * 4;
+
+			for (unsigned int by = 0; by < blocksY; by++)
+			{
+				for (unsigned int bx = 0; bx < blocksX; bx++)
+				{
+					const unsigned char	*block = source + ((size_t)by * blocksX + bx) * _blockBytes;
+					unsigned char		decoded[64];
+
+					switch (kind)
+					{
+						case 1:
+							decodeColorBlock(block, decoded, true);
+							break;
+						case 2:
+							decodeColorBlock(block + 8, decoded, false);
+							decodeExplicitAlphaBlock(block, decoded);
+							break;
+						case 3:
+							decodeColorBlock(block + 8, decoded, false);
+							decodeChannelBlock(block, decoded, 3);
+							break;
+						default:
+							for (int i = 0; i < 16; i++)
+							{
+								decoded[i * 4 + 1] = 0;
+								decoded[i * 4 + 2] = 0;
+								decoded[i * 4 + 3] = 255;
+							}
+							decodeChannelBlock(block, decoded, 0);
+							if (kind == 5)
+								decodeChannelBlock(block + 8, decoded, 1);
+							break;
+					}
+
+					// Blocks overhang the smallest levels
+					for (unsigned int y = 0; y < 4 && by * 4 + y < height; y++)
+					{
+						unsigned int columns = std::min(4u, width - bx * 4);
+
+						std::memcpy(destination + (((size_t)by * 4 + y) * width + bx * 4) * 4, decoded + y * 16, columns * 4);
+					}
+				}
+			}
+		}
+
+		_storage[level].swap(pixels);
+		_levels[level] = _storage[level].data();
+	}
+	_pFile.reset();
+
+	setFormat(srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8);
+	_pixelFormat = GL_RGBA;
+	return true;
+}
+
+size_t TextureContainer::upload(GLenum target, bool generateMipmaps)
+{
+	EXO_PROFILE_ZONE("TextureContainer::upload");
+
+	size_t	bytes = 0;
+	bool	immutable;
+
+	if (_compressed && !isFormatSupported(_format) && !decompress())
+		throw (std::runtime_error("texture format " + formatName(_format) + " is not supported by the driver"));
+
+	// Drivers can't generate compressed levels, those keep the base level only
+	generateMipmaps = generateMipmaps && _levels.size() == 1 && !_compressed;
+	// Compressed formats may lack glTexStorage, their levels are then specified one by one
+	immutable = !_compressed || Texture::hasImmutableStorage();
+
+	GL_CALL(glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0));
+	if (immutable)
+	{
+		Texture::allocateStorage(target, generateMipmaps ? Texture::getLevelCount(_width, _height) : (GLsizei)_levels.size(), _format, _width, _height, _layers);
+	}
+	else
+	{
+		GL_CALL(glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, (GLint)_levels.size() - 1));
+	}
+	// Rows are tightly packed, RGB ones aren't 4 bytes aligned
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+	for (unsigned int level = 0; level < _levels.size(); level++)
+	{
+		GLsizei			width = (GLsizei)std::max(_width >> level, 1u);
+		GLsizei			height = (GLsizei)std::max(_height >> level, 1u);
+		const GLvoid	*pixels = _levels[level];
+
+		if (target == GL_TEXTURE_2D_ARRAY)
+		{
+			GLsizei size = (GLsizei)(getLevelSize(level) * _layers);
+
+			if (!_compressed)
+			{
+				GL_CALL(glTexSubImage3D(target, level, 0, 0, 0, width, height, _layers, _pixelFormat, GL_UNSIGNED_BYTE, pixels));
+			}
+			else if (immutable)
+			{
+				GL_CALL(glCompressedTexSubImage3D(target, level, 0, 0, 0, width, height, _layers, _format, size, pixels));
+			}
+			else
+			{
+				GL_CALL(glCompressedTexImage3D(target, level, _format, width, height, _layers, 0, size, pixels));
+			}
+			bytes += size;
+		}
+		else
+		{
+			GLsizei size = (GLsizei)getLevelSize(level);
+
+			if (!_compressed)
+			{
+				GL_CALL(glTexSubImage2D(target, level, 0, 0, width, height, _pixelFormat, GL_UNSIGNED_BYTE, pixels));
+			}
+			else if (immutable)
+			{
+				GL_CALL(glCompressedTexSubImage2D(target, level, 0, 0, width, height, _format, size, pixels));
+			}
+			else
+			{
+				GL_CALL(glCompressedTexImage2D(target, level, _format, width, height, 0, size, pixels));
+			}
+			bytes += size;
+		}
+	}
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+	if (generateMipmaps)
+		GL_CALL(glGenerateMipmap(target));
+
+	return bytes;
+}
+
+size_t TextureContainer::getAllocatedSize(bool generateMipmaps) const
+{
+	size_t	size = 0;
+
+	for (unsigned int level = 0; level < _levels.size(); level++)
+		size += getLevelSize(level) * _layers;
+	if (generateMipmaps && _levels.size() == 1 && !_compressed)
+		size += size / 3;
+	return size;
+}
+
+// Getters
+GLenum TextureContainer::getFormat(void) const
+{
+	return _format;
+}
+
+GLenum TextureContainer::getPixelFormat(void) const
+{
+	return _pixelFormat;
+}
+
+bool TextureContainer::isCompressed(void) const
+{
+	return _compressed;
+}
+
+unsigned int TextureContainer::getWidth(void) const
+{
+	return _width;
+}
+
+unsigned int TextureContainer::getHeight(void) const
+{
+	return _height;
+}
+
+unsigned int TextureContainer::getLayers(void) const
+{
+	return _layers;
+}
+
+unsigned int TextureContainer::getLevels(void) const
+{
+	return (unsigned int)_levels.size();
+}
+
+size_t TextureContainer::getLevelSize(unsigned int level) const
+{
+	size_t width = std::max(_width >> level, 1u);
+	size_t height = std::max(_height >> level, 1u);
+
+	return ((width + _blockWidth - 1) / _blockWidth) * ((height + _blockHeight - 1) / _blockHeight) * _blockBytes;
+}
+
+const unsigned char *TextureContainer::getLevel(unsigned int level) const
+{
+	return _levels.at(level);
+}
+
+bool TextureContainer::isMapped(void) const
+{
+	return (bool)_pFile;
+}
+
+bool TextureContainer::isContainer(const std::string &filePath)
+{
+	size_t		dot = filePath.find_last_of('.');
+	std::string	extension = dot == std::string::npos ? "" : filePath.substr(dot + 1);
+
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower((unsigned char)c); });
+	return extension == "etex" || extension == "ktx" || extension == "ktx2" || extension == "dds";
+}
+
+bool TextureContainer::isFormatSupported(GLenum format)
+{
+	switch (format)
+	{
+		case GL_RGBA8:
+		case GL_SRGB8_ALPHA8:
+		case GL_RGB8:
+		// RGTC is core since 3.0
+		case GL_COMPRESSED_RED_RGTC1:
+		case GL_COMPRESSED_SIGNED_RED_RGTC1:
+		case GL_COMPRESSED_RG_RGTC2:
+		case GL_COMPRESSED_SIGNED_RG_RGTC2:
+			return true;
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+			return GLEW_EXT_texture_compression_s3tc;
+		case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+		case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+			return GLEW_EXT_texture_compression_s3tc && GLEW_EXT_texture_sRGB;
+		case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+		case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+		case GL_COMPRESSED_RGBA_BPTC_UNORM:
+		case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+			return GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc;
+		case GL_COMPRESSED_RGB8_ETC2:
+		case GL_COMPRESSED_SRGB8_ETC2:
+		case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+		case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+		case GL_COMPRESSED_RGBA8_ETC2_EAC:
+		case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+			return GLEW_VERSION_4_3 || GLEW_ARB_ES3_compatibility;
+		default:
+			if ((format >= GL_COMPRESSED_RGBA_ASTC_4x4_KHR && format <= GL_COMPRESSED_RGBA_ASTC_8x8_KHR)
+				|| (format >= GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR && format <= GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR))
+				return GLEW_KHR_texture_compression_astc_ldr;
+			return false;
+	}
+}
+
+void TextureContainer::loadETEX(const unsigned char *data, size_t size)
+{
+	need(0, 40, size);
+	if (read32(data + 4) != TEXTURE_FILE_VERSION)
+		throw (std::runtime_error("unsupported ETEX version " + std::to_string(read32(data + 4))));
+
+	uint32_t	format = read32(data + 12);
+	uint32_t	type = read32(data + 16);
+	uint32_t	levels = read32(data + 32);
+
+	setFormat(read32(data + 8));
+	if (!_compressed)
+	{
+		bool fourChannels = format == GL_RGBA || format == GL_BGRA;
+		bool threeChannels = format == GL_RGB || format == GL_BGR;
+
+		if (type != GL_UNSIGNED_BYTE || (_blockBytes == 4 ? !fourChannels : !threeChannels))
+			throw (std::runtime_error("ETEX pixel format doesn't match its internal format"));
+		_pixelFormat = format;
+	}
+
+	_width = read32(data + 20);
+	_height = read32(data + 24);
+	_layers = read32(data + 28);
+	checkHeader(levels, "ETEX");
+	_levels.resize(levels);
+
+	need(40, (uint64_t)levels * 16, size);
+	for (uint32_t level = 0; level < levels; level++)
+	{
+		uint64_t offset = read64(data + 40 + level * 16);
+		uint64_t length = read64(data + 40 + level * 16 + 8);
+
+		if (length != getLevelSize(level) * _layers)
+			throw (std::runtime_error("ETEX level " + std::to_string(level) + " has an unexpected size"));
+		need(offset, length, size);
+		_levels[level] = data + offset;
+	}
+}
+
+void TextureContainer::loadKTX(const unsigned char *data, size_t size)
+{
+	uint64_t	offset;
+
+	need(0, 64, size);
+	if (read32(data + 12) != 0x04030201)
+		throw (std::runtime_error("big endian KTX files are not supported"));
+
+	uint32_t	type = read32(data + 16);
+	uint32_t	format = read32(data + 24);
+	uint32_t	internalFormat = read32(data + 28);
+	uint32_t	depth = read32(data + 44);
+	uint32_t	elements = read32(data + 48);
+	uint32_t	faces = read32(data + 52);
+	uint32_t	levels = std::max(read32(data + 56), 1u);
+
+	if (faces != 1 || depth > 1)
+		throw (std::runtime_error("cube map and 3D KTX files are not supported"));
+
+	if (type == 0)
+		setFormat(internalFormat);
+	else if (type == GL_UNSIGNED_BYTE && format == GL_RGBA)
+		setFormat(internalFormat == GL_SRGB8_ALPHA8 ? GL_SRGB8_ALPHA8 : GL_RGBA8);
+	else
+		throw (std::runtime_error("uncompressed KTX files must be 8-bit RGBA"));
+
+	_width = read32(data + 36);
+	_height = std::max(read32(data + 40), 1u);
+	_layers = std::max(elements, 1u);
+	checkHeader(levels, "KTX");
+	_levels.resize(levels);
+
+	// Each level: its size, then every layer, padded to 4 bytes
+	offset = 64 + (uint64_t)read32(data + 60);
+	for (uint32_t level = 0; level < levels; level++)
+	{
+		need(offset, 4, size);
+		uint32_t imageSize = read32(data + offset);
+		offset += 4;
+
+		if (imageSize != getLevelSize(level) * _layers)
+			throw (std::runtime_error("KTX level " + std::to_string(level) + " has an unexpected size"));
+		need(offset, imageSize, size);
+		_levels[level] = data + offset;
+		offset += (imageSize + 3) & ~3u;
+	}
+}
+
+void TextureContainer::loadKTX2(const unsigned char *data, size_t size)
+{
+	need(0, 80, size);
+
+	uint32_t	vulkanFormat = read32(data + 12);
+	uint32_t	depth = read32(data + 28);
+	uint32_t	layers = read32(data + 32);
+	uint32_t	faces = read32(data + 36);
+	uint32_t	levels = std::max(read32(data + 40), 1u);
+	GLenum		format = findFormat(g_vulkanFormats, sizeof(g_vulkanFormats) / sizeof(g_vulkanFormats[0]), vulkanFormat);
+
+	if (read32(data + 44) != 0)
+		throw (std::runtime_error("supercompressed KTX2 files are not supported"));
+	if (faces != 1 || depth > 1)
+		throw (std::runtime_error("cube map and 3D KTX2 files are not supported"));
+	if (format == 0)
+		throw (std::runtime_error("unsupported KTX2 VkFormat " + std::to_string(vulkanFormat)));
+
+	setFormat(format);
+	_width = read32(data + 20);
+	_height = std::max(read32(data + 24), 1u);
+	_layers = std::max(layers, 1u);
+	checkHeader(levels, "KTX2");
+	_levels.resize(levels);
+
+	// Level index: offset, length and uncompressed length of each level, all layers included
+	need(80, (uint64_t)levels * 24, size);
+	for (uint32_t level = 0; level < levels; level++)
+	{
+		uint64_t offset = read64(data + 80 + level * 24);
+		uint64_t length = read64(data + 80 + level * 24 + 8);
+
+		if (length != getLevelSize(level) * _layers)
+			throw (std::runtime_error("KTX2 level " + std::to_string(level) + " has an unexpected size"));
+		need(offset, length, size);
+		_levels[level] = data + offset;
+	}
+}
+
+void TextureContainer::loadDDS(const unsigned char *data, size_t size)
+{
+	uint64_t	offset = 128;
+	bool		swizzle = false;	// BGRA
+	bool		opaque = false;		// No alpha channel
+
+	need(0, 128, size);
+
+	uint32_t	flags = read32(data + 8);
+	uint32_t	levels = (flags & 0x20000) ? std::max(read32(data + 28), 1u) : 1;	// DDSD_MIPMAPCOUNT
+	uint32_t	pixelFlags = read32(data + 80);
+	uint32_t	code = read32(data + 84);
+	uint32_t	caps2 = read32(data + 112);
+	GLenum		format = 0;
+
+	if (caps2 & (0x200 | 0x200000))
+		throw (std::runtime_error("cube map and volume DDS files are not supported"));
+
+	_layers = 1;
+	if ((pixelFlags & 0x4) && code == fourCC("DX10"))	// DDPF_FOURCC
+	{
+		need(128, 20, size);
+		uint32_t dxgiFormat = read32(data + 128);
+
+		if (read32(data + 136) & 0x4)
+			throw (std::runtime_error("cube map DDS files are not supported"));
+		format = findFormat(g_dxgiFormats, sizeof(g_dxgiFormats) / sizeof(g_dxgiFormats[0]), dxgiFormat);
+		swizzle = dxgiFormat == 87 || dxgiFormat == 91;
+		_layers = std::max(read32(data + 140), 1u);
+		offset = 148;
+		if (format == 0)
+			throw (std::runtime_error("unsupported DDS DXGI format " + std::to_string(dxgiFormat)));
+	}
+	else if (pixelFlags & 0x4)
+	{
+		if (code == fourCC("DXT1"))
+			format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+		else if (code == fourCC("DXT2") || code == fourCC("DXT3"))
+			format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+		else if (code == fourCC("DXT4") || code == fourCC("DXT5"))
+			format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		else if (code == fourCC("ATI1") || code == fourCC("BC4U"))
+			format = GL_COMPRESSED_RED_RGTC1;
+		else if (code == fourCC("BC4S"))
+			format = GL_COMPRESSED_SIGNED_RED_RGTC1;
+		else if (code == fourCC("ATI2") || code == fourCC("BC5U"))
+			format = GL_COMPRESSED_RG_RGTC2;
+		else if (code == fourCC("BC5S"))
+			format = GL_COMPRESSED_SIGNED_RG_RGTC2;
+		else
+			throw (std::runtime_error("unsupported DDS four character code"));
+	}
+	else if ((pixelFlags & 0x40) && read32(data + 88) == 32)	// DDPF_RGB
+	{
+		uint32_t redMask = read32(data + 92);
+		uint32_t blueMask = read32(data + 100);
+
+		if (redMask == 0xff && blueMask == 0xff0000)
+			format = GL_RGBA8;
+		else if (redMask == 0xff0000 && blueMask == 0xff)
+		{
+			format = GL_RGBA8;
+			swizzle = true;
+		}
+		else
+			throw (std::runtime_error("uncompressed DDS files must be 8-bit RGBA or BGRA"));
+		opaque = !(pixelFlags & 0x1);	// DDPF_ALPHAPIXELS
+	}
+	else
+		throw (std::runtime_error("unsupported DDS pixel format"));
+
+	setFormat(format);
+	_width = read32(data + 16);
+	_height = std::max(read32(data + 12), 1u);
+	checkHeader(levels, "DDS");
+	_levels.resize(levels);
+
+	// A single layer is already level by level
+	if (_layers == 1 && !swizzle && !opaque)
+	{
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			need(offset, getLevelSize(level), size);
+			_levels[level] = data + offset;
+			offset += getLevelSize(level);
+		}
+		return ;
+	}
+
+	// Every layer has to be in the file before any of them is copied
+	uint64_t layerSize = 0;
+	for (uint32_t level = 0; level < levels; level++)
+		layerSize += getLevelSize(level);
+	if (offset > size || (size - offset) / layerSize < _layers)
+		throw (std::runtime_error("truncated texture file"));
+
+	_storage.resize(levels);
+	for (uint32_t level = 0; level < levels; level++)
+	{
+		_storage[level].resize(getLevelSize(level) * _layers);
+		_levels[level] = _storage[level].data();
+	}
+
+	// Stored layer by layer, each with its whole mip chain
+	for (uint32_t layer = 0; layer < _layers; layer++)
+	{
+		for (uint32_t level = 0; level < levels; level++)
+		{
+			size_t levelSize = getLevelSize(level);
+
+			need(offset, levelSize, size);
+			setLevel(level, layer, data + offset);
+			offset += levelSize;
+		}
+	}
+
+	if (!swizzle && !opaque)
+		return ;
+	for (std::vector<unsigned char> &level : _storage)
+	{
+		for (size_t i = 0; i + 3 < level.size(); i += 4)
+		{
+			if (swizzle)
+				std::swap(level[i], level[i + 2]);
+			if (opaque)
+				level[i + 3] = 255;
+		}
+	}
+}
+
+void TextureContainer::setFormat(GLenum format)
+{
+	for (const FormatInfo &info : g_formats)
+	{
+		if (info.format == format)
+		{
+			_format = format;
+			_compressed = info.compressed;
+			_blockWidth = info.blockWidth;
+			_blockHeight = info.blockHeight;
+			_blockBytes = info.blockBytes;
+			_pixelFormat = info.blockBytes == 3 ? GL_RGB : GL_RGBA;
+			return ;
+		}
+	}
+	throw (std::runtime_error("unsupported texture format " + formatName(format)));
+}
+
+// Before a level is sized: past the full mip chain, getLevelSize() would shift by 32 or more
+void TextureContainer::checkHeader(uint32_t levels, const char *container) const
+{
+	if (_width == 0 || _height == 0 || _layers == 0 || levels == 0)
+		throw (std::runtime_error(std::string("empty ") + container + " file"));
+	if (_width > INT32_MAX || _height > INT32_MAX)
+		throw (std::runtime_error(std::string(container) + " file is too large"));
+	if (levels > (uint32_t)Texture::getLevelCount((GLsizei)_width, (GLsizei)_height))
+		throw (std::runtime_error(std::string(container) + " file has more mip levels than its size"));
+}
+
+void TextureContainer::setLevel(unsigned int level, unsigned int layer, const unsigned char *data)
+{
+	size_t levelSize = getLevelSize(level);
+
+	std::memcpy(_storage[level].data() + layer * levelSize, data, levelSize);
+}
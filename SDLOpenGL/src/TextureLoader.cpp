@@ -0,0 +1,354 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "TextureLoader.h"
+#include "FrameStats.h"
+#include "GPUMemory.h"
+#include "Profiler.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+
+TextureLoader	*TextureLoader::_pInstance = nullptr;
+
+TextureLoader::TextureLoader(void)
+: _pending(0), _budget(TEXTURE_UPLOAD_BUDGET), _nextBuffer(0)
+{
+	// Mid grey, 2x2 so it survives any filter and wrap mode
+	static const unsigned char	placeholder[16] = {
+		128, 128, 128, 255,		96, 96, 96, 255,
+		96, 96, 96, 255,		128, 128, 128, 255
+	};
+
+	GL_CALL(glGenBuffers(TEXTURE_UPLOAD_BUFFERS, _pixelBuffers));
+
+	GL_CALL(glGenTextures(1, &Texture::placeholderId));
+	GL_CALL(glBindTexture(GL_TEXTURE_2D, Texture::placeholderId));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+	GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+	GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder));
+	Texture::resetBinding();
+
+	_pWorkers = new ThreadPool();
+	_pInstance = this;
+}
+
+TextureLoader::~TextureLoader(void)
+{
+	_pInstance = nullptr;
+
+	// Waits for the decodes in progress, the queued ones are dropped
+	delete _pWorkers;
+
+	for (std::shared_ptr<TextureRequest> &request : _decoded)
+	{
+		SDL_FreeSurface(request->surface);
+		delete request->container;
+	}
+	_decoded.clear();
+
+	GL_CALL(glDeleteBuffers(TEXTURE_UPLOAD_BUFFERS, _pixelBuffers));
+	GL_CALL(glDeleteTextures(1, &Texture::placeholderId));
+	Texture::placeholderId = 0;
+}
+
+Texture *TextureLoader::load(const std::string &filePath, TextureFilter filter)
+{
+	std::shared_ptr<TextureRequest>	request = std::make_shared<TextureRequest>();
+	Texture							*texture;
+
+	request->filePath = filePath;
+	request->filter = filter;
+	request->surface = nullptr;
+	request->container = nullptr;
+	texture = new Texture(request);
+	request->texture = texture;
+
+	queue(request);
+	return texture;
+}
+
+bool TextureLoader::reload(Texture *texture)
+{
+	std::shared_ptr<TextureRequest>	request;
+
+	if (!_pInstance)
+		return false;
+
+	request = std::make_shared<TextureRequest>();
+	request->texture = texture;
+	request->filePath = texture->_filePath;
+	request->filter = texture->_filter;
+	request->surface = nullptr;
+	request->container = nullptr;
+	texture->_pRequest = request;
+
+	GPUMemory::reload();
+	_pInstance->queue(request);
+	return true;
+}
+
+void TextureLoader::upload(void)
+{
+	EXO_PROFILE_ZONE("TextureLoader::upload");
+
+	size_t	uploaded = 0;
+
+	while (true)
+	{
+		std::shared_ptr<TextureRequest>	request;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			if (_decoded.empty() || (uploaded > 0 && uploaded + getSize(*_decoded.front()) > _budget))
+				break ;
+			request = _decoded.front();
+			_decoded.pop_front();
+		}
+		uploaded += request->container ? uploadContainer(*request) : upload(*request);
+	}
+}
+
+// Getters
+size_t TextureLoader::getBudget(void) const
+{
+	return _budget;
+}
+
+size_t TextureLoader::getPendingCount(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pending;
+}
+
+ThreadPool *TextureLoader::getWorkers(void) const
+{
+	return _pWorkers;
+}
+
+// Setters
+void TextureLoader::setBudget(size_t bytes)
+{
+	_budget = bytes;
+}
+
+// Private
+void TextureLoader::queue(const std::shared_ptr<TextureRequest> &request)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_pending++;
+	}
+	_pWorkers->post([this, request]() { decode(request); });
+}
+
+void TextureLoader::decode(const std::shared_ptr<TextureRequest> &request)
+{
+	EXO_PROFILE_ZONE("TextureLoader::decode");
+
+	SDL_Surface	*image = nullptr;
+	bool		cancelled;
+
+	{
+		std::lock_guard<std::mutex> lock(request->mutex);
+		cancelled = request->texture == nullptr;
+	}
+
+	if (!cancelled && TextureContainer::isContainer(request->filePath))
+	{
+		TextureContainer	*container = new TextureContainer();
+
+		// Decompressed here rather than on the GL thread when the driver lacks the format
+		try
+		{
+			container->load(request->filePath);
+			if (container->isCompressed() && !TextureContainer::isFormatSupported(container->getFormat()) && !container->decompress())
+				throw (std::runtime_error("unsupported texture format"));
+			request->container = container;
+		}
+		catch (const std::exception&)
+		{
+			delete container;
+		}
+	}
+
+	if (!cancelled && !request->container)
+	{
+		image = IMG_Load(request->filePath.c_str());
+		if (!image)
+		{
+			// Same fallback as the synchronous load
+			image = Texture::generateDefaultTexture();
+			SDL_FillRect(image, NULL, SDL_MapRGB(image->format, 255, 0, 255));
+		}
+
+		// One layout for every file, the upload doesn't have to care
+		request->surface = SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_RGBA32, 0);
+		SDL_FreeSurface(image);
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pending--;
+	if (request->surface || request->container)
+		_decoded.push_back(request);
+}
+
+size_t TextureLoader::upload(TextureRequest &request)
+{
+	SDL_Surface	*surface = request.surface;
+	size_t		rowSize = (size_t)surface->w * 4;
+	size_t		size = rowSize * surface->h;
+	GLuint		id;
+	void		*pixels;
+
+	request.surface = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(request.mutex);
+		if (!request.texture)
+		{
+			SDL_FreeSurface(surface);
+			return 0;
+		}
+	}
+
+	// Orphaned then mapped, the driver copies to the texture asynchronously
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pixelBuffers[_nextBuffer]));
+	_nextBuffer = (_nextBuffer + 1) % TEXTURE_UPLOAD_BUFFERS;
+	GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW));
+	pixels = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (pixels)
+	{
+		for (int y = 0; y < surface->h; y++)
+			std::memcpy((unsigned char*)pixels + y * rowSize, (unsigned char*)surface->pixels + y * surface->pitch, rowSize);
+		GL_CALL(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+	}
+	else
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+	GL_CALL(glGenTextures(1, &id));
+	GL_CALL(glBindTexture(GL_TEXTURE_2D, id));
+	Texture::allocateStorage(GL_TEXTURE_2D, Texture::isMipmapped(request.filter) ? Texture::getLevelCount(surface->w, surface->h) : 1, GL_RGBA8, surface->w, surface->h);
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+	if (pixels)
+	{
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, surface->w, surface->h, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0));
+	}
+	else
+	{
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch / 4));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, surface->w, surface->h, GL_RGBA, GL_UNSIGNED_BYTE, surface->pixels));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+	}
+	if (Texture::isMipmapped(request.filter))
+	{
+		GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+	}
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	Texture::resetBinding();
+	FrameStats::uploadTexture(size);
+
+	{
+		std::lock_guard<std::mutex> lock(request.mutex);
+
+		if (request.texture)
+		{
+			request.texture->_id = id;
+			request.texture->_width = surface->w;
+			request.texture->_height = surface->h;
+			request.texture->setAllocated(GPUMemory::getSize(size, Texture::isMipmapped(request.filter)));
+			request.texture->_resident.store(true, std::memory_order_release);
+			request.texture->applySampler();
+			id = 0;
+		}
+	}
+
+	// Deleted while uploading
+	if (id)
+		GL_CALL(glDeleteTextures(1, &id));
+
+	SDL_FreeSurface(surface);
+	return size;
+}
+
+size_t TextureLoader::uploadContainer(TextureRequest &request)
+{
+	TextureContainer	*container = request.container;
+	size_t				size;
+	GLuint				id;
+
+	request.container = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(request.mutex);
+		if (!request.texture)
+		{
+			delete container;
+			return 0;
+		}
+	}
+
+	// Compressed levels are small, no pixel buffer
+	GL_CALL(glGenTextures(1, &id));
+	GL_CALL(glBindTexture(GL_TEXTURE_2D, id));
+	size = container->upload(GL_TEXTURE_2D, Texture::isMipmapped(request.filter));
+	Texture::resetBinding();
+	FrameStats::uploadTexture(size);
+
+	{
+		std::lock_guard<std::mutex> lock(request.mutex);
+
+		if (request.texture)
+		{
+			request.texture->_id = id;
+			request.texture->_width = container->getWidth();
+			request.texture->_height = container->getHeight();
+			request.texture->setAllocated(container->getAllocatedSize(Texture::isMipmapped(request.filter)));
+			request.texture->_resident.store(true, std::memory_order_release);
+			request.texture->applySampler();
+			id = 0;
+		}
+	}
+
+	if (id)
+		GL_CALL(glDeleteTextures(1, &id));
+
+	delete container;
+	return size;
+}
+
+size_t TextureLoader::getSize(const TextureRequest &request)
+{
+	size_t	size = 0;
+
+	if (request.surface)
+		return (size_t)request.surface->w * request.surface->h * 4;
+	for (unsigned int level = 0; level < request.container->getLevels(); level++)
+		size += request.container->getLevelSize(level);
+	return size;
+}
@@ -23,12 +23,24 @@
  */
 
 #include <SDL2/SDL_image.h>
+#include <SDL2/SDL_ttf.h>
 #include <iostream>
 #include <thread>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef __APPLE__
+# include <EGL/egl.h>
+# include <EGL/eglext.h>
+#endif
 
 #include "SDLException.h"
 #include "Window.h"
 #include "OGLCall.h"
+#include "RenderThread.h"
+#include "Profiler.h"
+#include "FrameStats.h"
 
 using namespace ExoRenderer;
 using namespace ExoRendererSDLOpenGL;
@@ -47,9 +59,15 @@ Window::~Window(void)
 	if (_frameTexture)
 		delete _frameTexture;
 
-	SDL_GL_DeleteContext(_context);
-	SDL_GL_DeleteContext(_threadContext);
-	SDL_DestroyWindow(_window);
+	if (_windowMode == WindowMode::HEADLESS)
+		releaseHeadless();
+	else
+	{
+		SDL_GL_DeleteContext(_context);
+		SDL_GL_DeleteContext(_threadContext);
+		SDL_DestroyWindow(_window);
+	}
+	TTF_Quit();
 	IMG_Quit();
 	SDL_Quit();
 }
@@ -99,12 +117,81 @@ void Window::initialize(const std::string& title, uint32_t width, uint32_t heigh
 	GLenum		error;
 #endif
 
-	if (!(SDL_WasInit(SDL_INIT_EVERYTHING) & SDL_INIT_VIDEO))
-		if (SDL_Init(SDL_INIT_EVERYTHING))
-			throw (SDLException());
+	_windowMode = mode;
+	if (_windowMode == WindowMode::HEADLESS)
+		initializeHeadless();
+	else
+		initializeWindow(title, width, height, resizable);
 
 	IMG_Init(IMG_INIT_PNG);
 	IMG_Init(IMG_INIT_JPG);
+	TTF_Init();
+
+#ifndef __APPLE__
+	// glewInit() also wants a GLX display, which a headless context does not have
+	if (glew_init == false)
+		if ((error = (_windowMode == WindowMode::HEADLESS ? glewContextInit() : glewInit())) != GLEW_OK)
+			throw (error);
+#endif
+
+	if (SDL_GameControllerAddMappingsFromFile("resources/SDL2/gamecontrollerdb.txt") == -1)
+		;	//	silent
+
+	// OpenGL setup
+	GL_CALL(glEnable(GL_CULL_FACE));
+	GL_CALL(glCullFace(GL_BACK));
+
+	// Without a default framebuffer the viewport starts empty
+	if (_windowMode == WindowMode::HEADLESS)
+		GL_CALL(glViewport(0, 0, width, height));
+
+	// Get Context size (can be different if HIGHDPI / Retina)
+	GLint dims[4] = {0};
+	glGetIntegerv(GL_VIEWPORT, dims);
+	_contextWidth = dims[2];
+	_contextHeight = dims[3];
+
+	_highDPIFactor = _contextWidth / _width;
+
+	// Post Processing
+	const static float tmp1[] = {
+		-1.0f,	1.0f, 0.0f,
+		-1.0f, -1.0f, 0.0f,
+		1.0f, -1.0f, 0.0f,
+
+		-1.0f,	1.0f, 0.0f,
+		1.0f, -1.0f, 0.0f,
+		1.0f,	1.0f, 0.0f
+	};
+	const static float tmp2[] = {
+		0.0f, 1.0f,
+		0.0f, 0.0f,
+		1.0f, 0.0f,
+
+		0.0f, 1.0f,
+		1.0f, 0.0f,
+		1.0f, 1.0f
+	};
+
+#ifdef USE_TEST_SHADERS
+	_postProcessing.initialize("resources/shaders/OpenGL3/post-processing/default.glsl");
+#else
+	_postProcessing.initialize(g_defaultShader);
+#endif
+	_postProcessing.bind();
+
+	_postVertexArrayObject.initialize(0, 0, NULL, BufferType::VERTEXARRAY, BufferDraw::STATIC, 0, false);
+	_postArrayBuffer.initialize(18, 3, &tmp1, BufferType::ARRAYBUFFER, BufferDraw::STATIC, 0, false);
+	_postUVMappingBuffer.initialize(12, 2, &tmp2, BufferType::ARRAYBUFFER, BufferDraw::STATIC, 1, true);
+
+	initPostProcessing();
+}
+
+void Window::initializeWindow(const std::string& title, uint32_t width, uint32_t height, bool resizable)
+{
+	if (!(SDL_WasInit(SDL_INIT_EVERYTHING) & SDL_INIT_VIDEO))
+		if (SDL_Init(SDL_INIT_EVERYTHING))
+			throw (SDLException());
 
 	if (SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1))
 	{
@@ -139,7 +226,6 @@ void Window::initialize(const std::string& title, uint32_t width, uint32_t heigh
 	}
 #endif
 
-	_windowMode = mode;
 	auto windowModeFlag = 0;
 	if (_windowMode == WindowMode::FULLSCREEN)
 		windowModeFlag = SDL_WINDOW_FULLSCREEN;
@@ -169,64 +255,102 @@ void Window::initialize(const std::string& title, uint32_t width, uint32_t heigh
 	}
 	SDL_GL_MakeCurrent(_window, _context);
 	SDL_ShowCursor(SDL_DISABLE); // Disable cursor
+}
 
-#ifndef __APPLE__
-	if (glew_init == false)
-		if ((error = glewInit()) != GLEW_OK)
-			throw (error);
-#endif
-
-	if (SDL_GameControllerAddMappingsFromFile("resources/SDL2/gamecontrollerdb.txt") == -1)
-		;	//	silent
+void Window::initializeHeadless(void)
+{
+#ifdef __APPLE__
+	throw (std::logic_error("headless mode requires EGL"));
+#else
+	const char	*extensions;
+	EGLConfig	config;
+	EGLint		count;
+	bool		surfaceless;
+
+	// No video subsystem, there may be no display server at all
+	if (!(SDL_WasInit(SDL_INIT_EVERYTHING) & SDL_INIT_EVENTS))
+		if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS))
+			throw (SDLException());
 
-	// OpenGL setup
-	GL_CALL(glEnable(GL_CULL_FACE));
-	GL_CALL(glCullFace(GL_BACK));
+	// Mesa surfaceless platform first, it needs neither X11 nor a GPU (llvmpipe)
+	_eglDisplay = EGL_NO_DISPLAY;
+	auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay)
+		_eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	if (_eglDisplay == EGL_NO_DISPLAY)
+		_eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (_eglDisplay == EGL_NO_DISPLAY || !eglInitialize(_eglDisplay, NULL, NULL))
+		throw (std::runtime_error("cannot initialize an EGL display"));
+	if (!eglBindAPI(EGL_OPENGL_API))
+		throw (std::runtime_error("EGL display does not support desktop OpenGL"));
+
+	extensions = eglQueryString(_eglDisplay, EGL_EXTENSIONS);
+	surfaceless = extensions && strstr(extensions, "EGL_KHR_surfaceless_context");
+
+	const EGLint	configAttributes[] = {
+		EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8,
+		EGL_GREEN_SIZE, 8,
+		EGL_BLUE_SIZE, 8,
+		EGL_ALPHA_SIZE, 8,
+		EGL_NONE
+	};
+	const EGLint	contextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 3,
+		EGL_CONTEXT_MINOR_VERSION, 2,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+	// Everything is drawn in _pFrameBuffer, the pbuffers only exist to make the contexts current
+	const EGLint	pbufferAttributes[] = {
+		EGL_WIDTH, 1,
+		EGL_HEIGHT, 1,
+		EGL_NONE
+	};
 
-	// Get Context size (can be different if HIGHDPI / Retina)
-	GLint dims[4] = {0};
-	glGetIntegerv(GL_VIEWPORT, dims);
-	_contextWidth = dims[2];
-	_contextHeight = dims[3];
+	if (!eglChooseConfig(_eglDisplay, configAttributes, &config, 1, &count) || count == 0)
+		throw (std::runtime_error("no suitable EGL config"));
 
-	_highDPIFactor = _contextWidth / _width;
+	// Same sharing as the SDL path: the thread context shares with the main one
+	if ((_eglThreadContext = eglCreateContext(_eglDisplay, config, EGL_NO_CONTEXT, contextAttributes)) == EGL_NO_CONTEXT)
+		throw (std::runtime_error("cannot create an OpenGL 3.2 core EGL context"));
+	if ((_eglContext = eglCreateContext(_eglDisplay, config, _eglThreadContext, contextAttributes)) == EGL_NO_CONTEXT)
+		throw (std::runtime_error("cannot create an OpenGL 3.2 core EGL context"));
 
-	// Post Processing
-	const static float tmp1[] = {
-		-1.0f,	1.0f, 0.0f,
-		-1.0f, -1.0f, 0.0f,
-		1.0f, -1.0f, 0.0f,
-
-		-1.0f,	1.0f, 0.0f,
-		1.0f, -1.0f, 0.0f,
-		1.0f,	1.0f, 0.0f
-	};
-	const static float tmp2[] = {
-		0.0f, 1.0f,
-		0.0f, 0.0f,
-		1.0f, 0.0f,
-
-		0.0f, 1.0f,
-		1.0f, 0.0f,
-		1.0f, 1.0f
-	};
+	_eglSurface = EGL_NO_SURFACE;
+	_eglThreadSurface = EGL_NO_SURFACE;
+	if (!surfaceless)
+	{
+		_eglSurface = eglCreatePbufferSurface(_eglDisplay, config, pbufferAttributes);
+		_eglThreadSurface = eglCreatePbufferSurface(_eglDisplay, config, pbufferAttributes);
+		if (_eglSurface == EGL_NO_SURFACE || _eglThreadSurface == EGL_NO_SURFACE)
+			throw (std::runtime_error("cannot create an EGL pbuffer"));
+	}
 
-#ifdef USE_TEST_SHADERS
-	_postProcessing.initialize("resources/shaders/OpenGL3/post-processing/default.glsl");
-#else
-	_postProcessing.initialize(g_defaultShader);
+	if (!eglMakeCurrent(_eglDisplay, _eglSurface, _eglSurface, _eglContext))
+		throw (std::runtime_error("cannot make the EGL context current"));
 #endif
-	_postProcessing.bind();
-
-	_postVertexArrayObject.initialize(0, 0, NULL, BufferType::VERTEXARRAY, BufferDraw::STATIC, 0, false);
-	_postArrayBuffer.initialize(18, 3, &tmp1, BufferType::ARRAYBUFFER, BufferDraw::STATIC, 0, false);
-	_postUVMappingBuffer.initialize(12, 2, &tmp2, BufferType::ARRAYBUFFER, BufferDraw::STATIC, 1, true);
+}
 
-	initPostProcessing();
+void Window::releaseHeadless(void)
+{
+#ifndef __APPLE__
+	eglMakeCurrent(_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (_eglSurface != EGL_NO_SURFACE)
+		eglDestroySurface(_eglDisplay, _eglSurface);
+	if (_eglThreadSurface != EGL_NO_SURFACE)
+		eglDestroySurface(_eglDisplay, _eglThreadSurface);
+	eglDestroyContext(_eglDisplay, _eglContext);
+	eglDestroyContext(_eglDisplay, _eglThreadContext);
+	eglTerminate(_eglDisplay);
+#endif
 }
 
 void Window::handleEvents(Keyboard& keyboard, Mouse& mouse, GamepadManager& gamepad)
 {
+	EXO_PROFILE_ZONE("Window::handleEvents");
+
 	while (SDL_PollEvent(&_event))
 	{
 		switch (_event.type)
@@ -292,16 +416,23 @@ void Window::handleEvents(Keyboard& keyboard, Mouse& mouse, GamepadManager& game
 	}
 }
 
-void Window::clearScreen(void)
+void Window::updateDelta(void)
 {
 	_last = _now;
 	_now = SDL_GetPerformanceCounter();
+}
 
+void Window::clearScreen(void)
+{
 	_pFrameBuffer->clear();
 }
 
-void Window::swap(void)
+void Window::postProcess(void)
 {
+	// Nothing to show, the frame stays in _pFrameBuffer for readPixels()
+	if (_windowMode == WindowMode::HEADLESS)
+		return ;
+
 	_pFrameBuffer->unbind(); // back to default
 	glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
 	glClear(GL_COLOR_BUFFER_BIT);
@@ -316,7 +447,57 @@ void Window::swap(void)
 	_frameTexture->bind();
 
 	GL_CALL(glDrawArrays(GL_TRIANGLES, 0, 6));
-	SDL_GL_SwapWindow(_window);
+	FrameStats::draw(2);
+}
+
+void Window::swap(void)
+{
+	if (_windowMode == WindowMode::HEADLESS)
+	{
+		GL_CALL(glFlush());
+	}
+	else
+		SDL_GL_SwapWindow(_window);
+}
+
+void Window::makeContextCurrent(void)
+{
+#ifndef __APPLE__
+	if (_windowMode == WindowMode::HEADLESS)
+	{
+		eglMakeCurrent(_eglDisplay, _eglSurface, _eglSurface, _eglContext);
+		return ;
+	}
+#endif
+	SDL_GL_MakeCurrent(_window, _context);
+}
+
+void Window::releaseContext(void)
+{
+#ifndef __APPLE__
+	if (_windowMode == WindowMode::HEADLESS)
+	{
+		eglMakeCurrent(_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		return ;
+	}
+#endif
+	SDL_GL_MakeCurrent(_window, nullptr);
+}
+
+void Window::readPixels(std::vector<unsigned char> &pixels)
+{
+	size_t	stride = (size_t)_contextWidth * 4;
+
+	pixels.resize(stride * _contextHeight);
+
+	_pFrameBuffer->bind();
+	GL_CALL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+	GL_CALL(glReadPixels(0, 0, _contextWidth, _contextHeight, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+	_pFrameBuffer->unbind();
+
+	// OpenGL rows start at the bottom
+	for (int y = 0; y < _contextHeight / 2; y++)
+		std::swap_ranges(pixels.begin() + y * stride, pixels.begin() + (y + 1) * stride, pixels.begin() + (_contextHeight - 1 - y) * stride);
 }
 
 void	Window::handleThread(void)
@@ -325,8 +506,18 @@ void	Window::handleThread(void)
 	int					 error;
 
 	if (std::this_thread::get_id() != prev)
+	{
+#ifndef __APPLE__
+		if (_windowMode == WindowMode::HEADLESS)
+		{
+			if (eglMakeCurrent(_eglDisplay, _eglThreadSurface, _eglThreadSurface, _eglThreadContext))
+				prev = std::this_thread::get_id();
+			return ;
+		}
+#endif
 		if ((error = SDL_GL_MakeCurrent(_window, _threadContext)))
 			prev = std::this_thread::get_id();
+	}
 }
 
 IFrameBuffer *Window::getFrameBuffer(void) const
@@ -344,9 +535,7 @@ void Window::initPostProcessing(void)
 		delete _frameTexture;
 
 	// Color Texture
-	_frameTexture = new Texture(_contextWidth, _contextHeight, RGBA, NEAREST);
-	GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-	GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	_frameTexture = new Texture(_contextWidth, _contextHeight, RGBA, NEAREST, GL_CLAMP_TO_EDGE);
 
 	// Framebuffer
 	_pFrameBuffer = new FrameBuffer();
@@ -361,25 +550,36 @@ void Window::initPostProcessing(void)
 // Setters
 void Window::setWindowSize(int w, int h)
 {
-	SDL_SetWindowSize(_window, w, h);
+	if (_windowMode != WindowMode::HEADLESS)
+		SDL_SetWindowSize(_window, w, h);
 	_width = w;
 	_height = h;
-	glViewport(0, 0, w * _highDPIFactor, h * _highDPIFactor);
 
-	// Update Post Processing Buffer
-	//> Get Context size (can be different if HIGHDPI / Retina)
-	GLint dims[4] = {0};
-	glGetIntegerv(GL_VIEWPORT, dims);
-	_contextWidth = dims[2];
-	_contextHeight = dims[3];
+	RenderThread::invoke([this, w, h]() {
+		glViewport(0, 0, w * _highDPIFactor, h * _highDPIFactor);
 
-	//> Post Processing
-	initPostProcessing();
+		// Update Post Processing Buffer
+		//> Get Context size (can be different if HIGHDPI / Retina)
+		GLint dims[4] = {0};
+		glGetIntegerv(GL_VIEWPORT, dims);
+		_contextWidth = dims[2];
+		_contextHeight = dims[3];
+
+		//> Post Processing
+		initPostProcessing();
+	});
 }
 
 void Window::setWindowMode(const WindowMode &mode)
 {
 	int error = 0;
+
+	// The context type is chosen at initialize
+	if ((mode == WindowMode::HEADLESS) != (_windowMode == WindowMode::HEADLESS))
+		throw (std::invalid_argument("headless mode can only be set at initialize"));
+	if (mode == WindowMode::HEADLESS)
+		return ;
+
 	switch (mode)
 	{
 		case FULLSCREEN:
@@ -409,24 +609,34 @@ void Window::setWindowMode(const WindowMode &mode)
 		_contextHeight = displayMode.h;
 	}
 	else
-	{
 		SDL_GetWindowSize(_window, &_width, &_height);
-		glViewport(0, 0, _width * _highDPIFactor, _height * _highDPIFactor);
 
-		GLint dims[4] = {0};
-		glGetIntegerv(GL_VIEWPORT, dims);
-		_contextWidth = dims[2];
-		_contextHeight = dims[3];
-	}
+	RenderThread::invoke([this]() {
+		if (_windowMode != WindowMode::FULLSCREEN)
+		{
+			glViewport(0, 0, _width * _highDPIFactor, _height * _highDPIFactor);
 
-	//> Post Processing
-	initPostProcessing();
+			GLint dims[4] = {0};
+			glGetIntegerv(GL_VIEWPORT, dims);
+			_contextWidth = dims[2];
+			_contextHeight = dims[3];
+		}
+
+		//> Post Processing
+		initPostProcessing();
+	});
 }
 
 void Window::setVsync(bool vsync)
 {
-	if (SDL_GL_SetSwapInterval(vsync == true ? 1 : 0) == -1)
-		throw (SDLException());
+	if (_windowMode == WindowMode::HEADLESS)
+		return ;
+
+	// The swap interval belongs to the context, set it where it is current
+	RenderThread::invoke([vsync]() {
+		if (SDL_GL_SetSwapInterval(vsync == true ? 1 : 0) == -1)
+			throw (SDLException());
+	});
 }
 
 // Getters
@@ -465,6 +675,11 @@ bool Window::isFullscreen(void) const
 	return _windowMode == WindowMode::FULLSCREEN;
 }
 
+bool Window::isHeadless(void) const
+{
+	return _windowMode == WindowMode::HEADLESS;
+}
+
 bool Window::getIsClosing(void) const
 {
 	return _close;
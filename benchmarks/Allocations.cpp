@@ -0,0 +1,96 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+std::atomic<uint64_t>	g_allocations(0);
+
+void	*allocate(std::size_t size)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	return std::malloc(size ? size : 1);
+}
+
+}
+
+uint64_t ExoRendererBenchmarks::getAllocationCount(void)
+{
+	return g_allocations.load(std::memory_order_relaxed);
+}
+
+// The aligned overloads keep their default implementation
+void	*operator new(std::size_t size)
+{
+	void *pointer = allocate(size);
+
+	if (!pointer)
+		throw (std::bad_alloc());
+	return pointer;
+}
+
+void	*operator new[](std::size_t size)
+{
+	void *pointer = allocate(size);
+
+	if (!pointer)
+		throw (std::bad_alloc());
+	return pointer;
+}
+
+void	*operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return allocate(size);
+}
+
+void	*operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return allocate(size);
+}
+
+void	operator delete(void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void	operator delete[](void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void	operator delete(void *pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+void	operator delete[](void *pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
@@ -0,0 +1,269 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Assets.h"
+
+#include <SDL2/SDL.h>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+using namespace ExoRenderer;
+using namespace ExoRendererBenchmarks;
+
+// Glyph cells of the generated font
+#define FONT_CELL		32
+#define FONT_COLUMNS	16
+#define FONT_WIDTH		512
+#define FONT_HEIGHT		256
+// First glyph of the descriptors written by getFontPath
+#define FONT_FIRST_GLYPH	0x4E00
+
+namespace
+{
+
+SDL_Surface	*createSurface(unsigned int width, unsigned int height)
+{
+	SDL_Surface *surface = SDL_CreateRGBSurface(0, width, height, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+
+	if (!surface)
+		throw (std::runtime_error(std::string("SDL_CreateRGBSurface: ") + SDL_GetError()));
+	return surface;
+}
+
+void	saveSurface(SDL_Surface *surface, const std::string &path)
+{
+	int result = SDL_SaveBMP(surface, path.c_str());
+
+	SDL_FreeSurface(surface);
+	if (result != 0)
+		throw (std::runtime_error("SDL_SaveBMP " + path + ": " + SDL_GetError()));
+}
+
+void	write16(std::ofstream &file, uint16_t value)
+{
+	file.put((char)(value & 0xff));
+	file.put((char)(value >> 8));
+}
+
+void	write32(std::ofstream &file, uint32_t value)
+{
+	write16(file, (uint16_t)(value & 0xffff));
+	write16(file, (uint16_t)(value >> 16));
+}
+
+}
+
+// Random
+Random::Random(uint32_t seed)
+: _state(seed ? seed : 1)
+{ }
+
+uint32_t Random::next(void)
+{
+	// Numerical Recipes LCG
+	_state = _state * 1664525u + 1013904223u;
+	return _state;
+}
+
+float Random::range(float min, float max)
+{
+	return min + (max - min) * ((next() >> 8) / (float)(1u << 24));
+}
+
+// Assets
+Assets::Assets(void)
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / ("exo-benchmarks-" + std::to_string((unsigned long long)SDL_GetPerformanceCounter()));
+
+	std::filesystem::create_directories(directory);
+	_directory = directory.string();
+}
+
+Assets::~Assets(void)
+{
+	std::error_code	error;
+
+	_pFont.reset();
+	_pWidgetTexture.reset();
+	std::filesystem::remove_all(_directory, error);
+}
+
+std::string Assets::getTexturePath(unsigned int width, unsigned int height, unsigned int variant)
+{
+	std::string path = (std::filesystem::path(_directory) / ("texture_" + std::to_string(width) + "x" + std::to_string(height) + "_" + std::to_string(variant) + ".bmp")).string();
+
+	for (const std::string &file : _files)
+		if (file == path)
+			return path;
+
+	SDL_Surface	*surface = createSurface(width, height);
+	Random		random(variant + 1);
+	Uint32		colors[2];
+
+	for (Uint32 &color : colors)
+	{
+		uint32_t bits = random.next();
+		color = SDL_MapRGBA(surface->format, (bits >> 24) & 0xff, (bits >> 16) & 0xff, (bits >> 8) & 0xff, 255);
+	}
+
+	// Checkerboard, so resampling has something to work with
+	for (unsigned int y = 0; y < height; y++)
+	{
+		Uint32 *row = (Uint32*)((Uint8*)surface->pixels + y * surface->pitch);
+		for (unsigned int x = 0; x < width; x++)
+			row[x] = colors[((x / 8) + (y / 8)) & 1];
+	}
+
+	saveSurface(surface, path);
+	_files.push_back(path);
+	return path;
+}
+
+const std::shared_ptr<ITexture> &Assets::getWidgetTexture(IRenderer &renderer)
+{
+	if (!_pWidgetTexture)
+		_pWidgetTexture.reset(renderer.createTexture(getTexturePath(96, 32, 1000)));
+	return _pWidgetTexture;
+}
+
+const std::shared_ptr<Font> &Assets::getFont(IRenderer &renderer)
+{
+	if (!_pFont)
+	{
+		std::string fnt = writeFont();
+		std::shared_ptr<ITexture> texture(renderer.createTexture(fnt.substr(0, fnt.size() - 4) + ".bmp"));
+
+		_pFont = std::make_shared<Font>(std::make_shared<FntLoader>(fnt), texture);
+	}
+	return _pFont;
+}
+
+std::string Assets::getFontPath(unsigned int glyphs, bool binary)
+{
+	std::string		path = (std::filesystem::path(_directory) / ("font_" + std::to_string(glyphs) + (binary ? ".bin.fnt" : ".fnt"))).string();
+	std::ofstream	fnt;
+
+	for (const std::string &file : _files)
+		if (file == path)
+			return path;
+
+	// Cells of 32 pixels in a 4096 wide page, like a large CJK font
+	fnt.open(path, binary ? std::ios::binary : std::ios::out);
+	if (binary)
+	{
+		fnt.write("BMF\3", 4);
+		fnt.put(2);
+		write32(fnt, 15);
+		write16(fnt, FONT_CELL);
+		write16(fnt, FONT_CELL - 6);
+		write16(fnt, 4096);
+		write16(fnt, 4096);
+		write16(fnt, 1);
+		for (int i = 0; i < 5; i++)
+			fnt.put(0);
+
+		fnt.put(4);
+		write32(fnt, glyphs * 20);
+		for (unsigned int i = 0; i < glyphs; i++)
+		{
+			write32(fnt, FONT_FIRST_GLYPH + i);
+			write16(fnt, (uint16_t)((i % 128) * FONT_CELL));
+			write16(fnt, (uint16_t)((i / 128 % 128) * FONT_CELL));
+			write16(fnt, FONT_CELL);
+			write16(fnt, FONT_CELL);
+			write16(fnt, 0);
+			write16(fnt, 2);
+			write16(fnt, FONT_CELL - 2);
+			fnt.put(0);
+			fnt.put(15);
+		}
+
+		fnt.put(5);
+		write32(fnt, glyphs * 10);
+		for (unsigned int i = 0; i < glyphs; i++)
+		{
+			write32(fnt, FONT_FIRST_GLYPH + i);
+			write32(fnt, FONT_FIRST_GLYPH + (i + 1) % glyphs);
+			write16(fnt, (uint16_t)-1);
+		}
+	}
+	else
+	{
+		fnt << "info face=\"benchmark cjk\" size=" << FONT_CELL << " bold=0 italic=0 charset=\"\" unicode=1 padding=0,0,0,0\n";
+		fnt << "common lineHeight=" << FONT_CELL << " base=" << FONT_CELL - 6 << " scaleW=4096 scaleH=4096 pages=1\n";
+		fnt << "page id=0 file=\"font.bmp\"\n";
+		fnt << "chars count=" << glyphs << "\n";
+		for (unsigned int i = 0; i < glyphs; i++)
+			fnt << "char id=" << FONT_FIRST_GLYPH + i << "   x=" << (i % 128) * FONT_CELL << "    y=" << (i / 128 % 128) * FONT_CELL
+				<< "    width=" << FONT_CELL << "    height=" << FONT_CELL << "    xoffset=0     yoffset=2     xadvance=" << FONT_CELL - 2
+				<< "    page=0  chnl=15\n";
+		fnt << "kernings count=" << glyphs << "\n";
+		for (unsigned int i = 0; i < glyphs; i++)
+			fnt << "kerning first=" << FONT_FIRST_GLYPH + i << "  second=" << FONT_FIRST_GLYPH + (i + 1) % glyphs << "  amount=-1\n";
+	}
+	fnt.close();
+
+	_files.push_back(path);
+	return path;
+}
+
+// Getters
+const std::string &Assets::getDirectory(void) const
+{
+	return _directory;
+}
+
+// Private
+std::string Assets::writeFont(void)
+{
+	std::string		path = (std::filesystem::path(_directory) / "font.fnt").string();
+	std::string		page = (std::filesystem::path(_directory) / "font.bmp").string();
+	std::ofstream	fnt(path);
+	SDL_Surface		*surface = createSurface(FONT_WIDTH, FONT_HEIGHT);
+
+	SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, 0, 0, 0, 0));
+
+	// Printable ASCII, one box per cell, narrower than the cell to keep glyphs apart
+	fnt << "info face=\"benchmark\" size=" << FONT_CELL << "\n";
+	fnt << "common lineHeight=" << FONT_CELL << " base=" << FONT_CELL - 6 << " scaleW=" << FONT_WIDTH << " scaleH=" << FONT_HEIGHT << " pages=1\n";
+	for (unsigned int id = 32; id < 127; id++)
+	{
+		unsigned int	index = id - 32;
+		int				x = (index % FONT_COLUMNS) * FONT_CELL;
+		int				y = (index / FONT_COLUMNS) * FONT_CELL;
+		SDL_Rect		box = {x + 4, y + 4, FONT_CELL - 12, FONT_CELL - 8};
+
+		if (id != ' ')
+			SDL_FillRect(surface, &box, SDL_MapRGBA(surface->format, 255, 255, 255, 255));
+		fnt << "char id=" << id << " x=" << x << " y=" << y << " width=" << FONT_CELL << " height=" << FONT_CELL
+			<< " xoffset=0 yoffset=0 xadvance=" << FONT_CELL - 8 << "\n";
+	}
+	fnt.close();
+
+	saveSurface(surface, page);
+	_files.push_back(path);
+	_files.push_back(page);
+	return path;
+}
@@ -0,0 +1,77 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "IRenderer.h"
+#include "Font.h"
+
+namespace	ExoRendererBenchmarks
+{
+
+// Deterministic pseudo random numbers, identical on every platform
+class Random
+{
+public:
+	Random(uint32_t seed = 1);
+
+	uint32_t	next(void);
+	float		range(float min, float max);
+private:
+	uint32_t	_state;
+};
+
+// Generated textures and font, written once to a temporary directory so
+// every run loads exactly the same data through the regular file loaders
+class Assets
+{
+public:
+	Assets(void);
+	~Assets(void);
+
+	// Path of a width x height BMP, "variant" changes the pattern
+	std::string	getTexturePath(unsigned int width, unsigned int height, unsigned int variant = 0);
+	// Path of a BMFont descriptor of CJK glyphs with a kerning pair per glyph, text or binary
+	std::string	getFontPath(unsigned int glyphs, bool binary);
+
+	// Loaded once per renderer
+	const std::shared_ptr<ExoRenderer::ITexture>	&getWidgetTexture(ExoRenderer::IRenderer &renderer);
+	const std::shared_ptr<ExoRenderer::Font>		&getFont(ExoRenderer::IRenderer &renderer);
+
+	// Getters
+	const std::string	&getDirectory(void) const;
+private:
+	std::string	writeFont(void);
+
+	std::string									_directory;
+	std::vector<std::string>					_files;
+	std::shared_ptr<ExoRenderer::ITexture>		_pWidgetTexture;
+	std::shared_ptr<ExoRenderer::Font>			_pFont;
+};
+
+}
@@ -0,0 +1,444 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Json.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace ExoRendererBenchmarks;
+
+namespace
+{
+
+class Parser
+{
+public:
+	Parser(const std::string &text)
+	: _text(text), _position(0)
+	{ }
+
+	JsonValue	parseDocument(void)
+	{
+		JsonValue value = parseValue();
+
+		skipSpaces();
+		if (_position != _text.size())
+			fail("trailing characters");
+		return value;
+	}
+private:
+	JsonValue	parseValue(void)
+	{
+		skipSpaces();
+		if (_position >= _text.size())
+			fail("unexpected end");
+
+		switch (_text[_position])
+		{
+			case '{':
+				return parseObject();
+			case '[':
+				return parseArray();
+			case '"':
+				return JsonValue(parseString());
+			case 't':
+				expect("true");
+				return JsonValue::boolean(true);
+			case 'f':
+				expect("false");
+				return JsonValue::boolean(false);
+			case 'n':
+				expect("null");
+				return JsonValue();
+			default:
+				return parseNumber();
+		}
+	}
+
+	JsonValue	parseObject(void)
+	{
+		JsonValue object = JsonValue::object();
+
+		_position++;
+		skipSpaces();
+		if (peek() == '}')
+		{
+			_position++;
+			return object;
+		}
+		while (true)
+		{
+			skipSpaces();
+			if (peek() != '"')
+				fail("expected a key");
+			std::string key = parseString();
+			skipSpaces();
+			if (peek() != ':')
+				fail("expected ':'");
+			_position++;
+			object.set(key, parseValue());
+			skipSpaces();
+			if (peek() == ',')
+				_position++;
+			else if (peek() == '}')
+			{
+				_position++;
+				return object;
+			}
+			else
+				fail("expected ',' or '}'");
+		}
+	}
+
+	JsonValue	parseArray(void)
+	{
+		JsonValue array = JsonValue::array();
+
+		_position++;
+		skipSpaces();
+		if (peek() == ']')
+		{
+			_position++;
+			return array;
+		}
+		while (true)
+		{
+			array.push(parseValue());
+			skipSpaces();
+			if (peek() == ',')
+				_position++;
+			else if (peek() == ']')
+			{
+				_position++;
+				return array;
+			}
+			else
+				fail("expected ',' or ']'");
+		}
+	}
+
+	std::string	parseString(void)
+	{
+		std::string	result;
+
+		_position++;
+		while (_position < _text.size() && _text[_position] != '"')
+		{
+			char c = _text[_position++];
+
+			if (c != '\\')
+			{
+				result += c;
+				continue ;
+			}
+			if (_position >= _text.size())
+				break ;
+			switch (_text[_position++])
+			{
+				case 'n': result += '\n'; break;
+				case 't': result += '\t'; break;
+				case 'r': result += '\r'; break;
+				case 'b': result += '\b'; break;
+				case 'f': result += '\f'; break;
+				case 'u':
+					// Reports only hold ASCII, keep the code point if it fits
+					if (_position + 4 > _text.size())
+						fail("truncated escape");
+					result += (char)std::strtol(_text.substr(_position, 4).c_str(), nullptr, 16);
+					_position += 4;
+					break;
+				default: result += _text[_position - 1]; break;
+			}
+		}
+		if (_position >= _text.size())
+			fail("unterminated string");
+		_position++;
+		return result;
+	}
+
+	JsonValue	parseNumber(void)
+	{
+		const char	*begin = _text.c_str() + _position;
+		char		*end = nullptr;
+		double		number = std::strtod(begin, &end);
+
+		if (end == begin)
+			fail("unexpected character");
+		_position += end - begin;
+		return JsonValue(number);
+	}
+
+	void	expect(const char *word)
+	{
+		std::string expected(word);
+
+		if (_text.compare(_position, expected.size(), expected) != 0)
+			fail("unexpected literal");
+		_position += expected.size();
+	}
+
+	char	peek(void) const
+	{
+		return _position < _text.size() ? _text[_position] : '\0';
+	}
+
+	void	skipSpaces(void)
+	{
+		while (_position < _text.size() && (_text[_position] == ' ' || _text[_position] == '\t' || _text[_position] == '\n' || _text[_position] == '\r'))
+			_position++;
+	}
+
+	[[noreturn]] void	fail(const char *reason) const
+	{
+		throw (std::runtime_error("JSON: " + std::string(reason) + " at offset " + std::to_string(_position)));
+	}
+
+	const std::string	&_text;
+	size_t				_position;
+};
+
+void	dumpString(std::string &out, const std::string &string)
+{
+	out += '"';
+	for (char c : string)
+	{
+		switch (c)
+		{
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				if ((unsigned char)c < 0x20)
+				{
+					char escaped[8];
+					std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned int)c);
+					out += escaped;
+				}
+				else
+					out += c;
+				break;
+		}
+	}
+	out += '"';
+}
+
+void	newLine(std::string &out, unsigned int indent, unsigned int depth)
+{
+	if (indent == 0)
+		return ;
+	out += '\n';
+	out.append(indent * depth, ' ');
+}
+
+}
+
+JsonValue::JsonValue(void)
+: _type(NUL), _number(0.0)
+{ }
+
+JsonValue::JsonValue(double number)
+: _type(NUMBER), _number(number)
+{ }
+
+JsonValue::JsonValue(const std::string &string)
+: _type(STRING), _number(0.0), _string(string)
+{ }
+
+JsonValue::JsonValue(const char *string)
+: _type(STRING), _number(0.0), _string(string)
+{ }
+
+JsonValue::~JsonValue(void)
+{ }
+
+JsonValue JsonValue::array(void)
+{
+	JsonValue value;
+
+	value._type = ARRAY;
+	return value;
+}
+
+JsonValue JsonValue::object(void)
+{
+	JsonValue value;
+
+	value._type = OBJECT;
+	return value;
+}
+
+JsonValue JsonValue::boolean(bool boolean)
+{
+	JsonValue value;
+
+	value._type = BOOLEAN;
+	value._number = boolean ? 1.0 : 0.0;
+	return value;
+}
+
+JsonValue JsonValue::parse(const std::string &text)
+{
+	return Parser(text).parseDocument();
+}
+
+void JsonValue::push(const JsonValue &value)
+{
+	if (_type != ARRAY)
+		throw (std::logic_error("JsonValue::push on a non array value"));
+	_elements.push_back(value);
+}
+
+void JsonValue::set(const std::string &key, const JsonValue &value)
+{
+	if (_type != OBJECT)
+		throw (std::logic_error("JsonValue::set on a non object value"));
+
+	for (auto &member : _members)
+	{
+		if (member.first == key)
+		{
+			member.second = value;
+			return ;
+		}
+	}
+	_members.emplace_back(key, value);
+}
+
+std::string JsonValue::dump(unsigned int indent) const
+{
+	std::string	out;
+
+	dump(out, indent, 0);
+	return out;
+}
+
+// Getters
+JsonValue::Type JsonValue::getType(void) const
+{
+	return _type;
+}
+
+double JsonValue::getNumber(void) const
+{
+	return _number;
+}
+
+bool JsonValue::getBoolean(void) const
+{
+	return _number != 0.0;
+}
+
+const std::string &JsonValue::getString(void) const
+{
+	return _string;
+}
+
+size_t JsonValue::getSize(void) const
+{
+	return _type == OBJECT ? _members.size() : _elements.size();
+}
+
+const JsonValue &JsonValue::get(size_t index) const
+{
+	return _elements.at(index);
+}
+
+const JsonValue *JsonValue::find(const std::string &key) const
+{
+	for (const auto &member : _members)
+		if (member.first == key)
+			return &member.second;
+	return nullptr;
+}
+
+const std::vector<std::pair<std::string, JsonValue>> &JsonValue::getMembers(void) const
+{
+	return _members;
+}
+
+// Private
+void JsonValue::dump(std::string &out, unsigned int indent, unsigned int depth) const
+{
+	switch (_type)
+	{
+		case NUL:
+			out += "null";
+			break;
+		case BOOLEAN:
+			out += getBoolean() ? "true" : "false";
+			break;
+		case NUMBER: {
+			char number[32];
+
+			if (!std::isfinite(_number))
+				out += "null";
+			else if (_number == std::floor(_number) && std::fabs(_number) < 1e15)
+			{
+				std::snprintf(number, sizeof(number), "%.0f", _number);
+				out += number;
+			}
+			else
+			{
+				std::snprintf(number, sizeof(number), "%.10g", _number);
+				out += number;
+			}
+			break;
+		}
+		case STRING:
+			dumpString(out, _string);
+			break;
+		case ARRAY:
+			out += '[';
+			for (size_t i = 0; i < _elements.size(); i++)
+			{
+				if (i)
+					out += ',';
+				newLine(out, indent, depth + 1);
+				_elements[i].dump(out, indent, depth + 1);
+			}
+			if (!_elements.empty())
+				newLine(out, indent, depth);
+			out += ']';
+			break;
+		case OBJECT:
+			out += '{';
+			for (size_t i = 0; i < _members.size(); i++)
+			{
+				if (i)
+					out += ',';
+				newLine(out, indent, depth + 1);
+				dumpString(out, _members[i].first);
+				out += indent ? ": " : ":";
+				_members[i].second.dump(out, indent, depth + 1);
+			}
+			if (!_members.empty())
+				newLine(out, indent, depth);
+			out += '}';
+			break;
+	}
+}
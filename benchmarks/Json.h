@@ -0,0 +1,86 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace	ExoRendererBenchmarks
+{
+
+// Minimal JSON document, enough to write reports and read them back for --compare
+class JsonValue
+{
+public:
+	enum Type
+	{
+		NUL,
+		BOOLEAN,
+		NUMBER,
+		STRING,
+		ARRAY,
+		OBJECT
+	};
+
+	JsonValue(void);
+	JsonValue(double number);
+	JsonValue(const std::string &string);
+	JsonValue(const char *string);
+	~JsonValue(void);
+
+	static JsonValue	array(void);
+	static JsonValue	object(void);
+	static JsonValue	boolean(bool value);
+
+	// Throws std::runtime_error on malformed input
+	static JsonValue	parse(const std::string &text);
+
+	void	push(const JsonValue &value);
+	void	set(const std::string &key, const JsonValue &value);
+
+	std::string	dump(unsigned int indent = 0) const;
+
+	// Getters
+	Type				getType(void) const;
+	double				getNumber(void) const;
+	bool				getBoolean(void) const;
+	const std::string	&getString(void) const;
+	size_t				getSize(void) const;
+	const JsonValue		&get(size_t index) const;
+	const JsonValue		*find(const std::string &key) const;	// nullptr if missing
+
+	const std::vector<std::pair<std::string, JsonValue>>	&getMembers(void) const;
+private:
+	void	dump(std::string &out, unsigned int indent, unsigned int depth) const;
+
+	Type											_type;
+	double											_number;
+	std::string										_string;
+	std::vector<JsonValue>							_elements;
+	std::vector<std::pair<std::string, JsonValue>>	_members;	// Insertion order
+};
+
+}
@@ -0,0 +1,226 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Report.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+
+using namespace ExoRenderer;
+using namespace ExoRendererBenchmarks;
+
+namespace
+{
+
+struct StatsCounter
+{
+	const char	*name;
+	double		(*get)(const RenderStats &stats);
+	bool		workload;	// Describes the scenario rather than its cost, never a regression
+};
+
+const StatsCounter	g_counters[] = {
+	{"drawCalls",		[](const RenderStats &s) { return (double)s.drawCalls; },		false},
+	{"instances",		[](const RenderStats &s) { return (double)s.instances; },		true},
+	{"triangles",		[](const RenderStats &s) { return (double)s.triangles; },		true},
+	{"textureBinds",	[](const RenderStats &s) { return (double)s.textureBinds; },	false},
+	{"programBinds",	[](const RenderStats &s) { return (double)s.programBinds; },	false},
+	{"uniformUploads",	[](const RenderStats &s) { return (double)s.uniformUploads; },	false},
+	{"bufferBytes",		[](const RenderStats &s) { return (double)s.bufferBytes; },		false},
+	{"textureBytes",	[](const RenderStats &s) { return (double)s.textureBytes; },	false},
+	{"scissorChanges",	[](const RenderStats &s) { return (double)s.scissorChanges; },	false},
+	{"spritesDrawn",	[](const RenderStats &s) { return (double)s.spritesDrawn; },	true},
+	{"spritesCulled",	[](const RenderStats &s) { return (double)s.spritesCulled; },	true},
+	{"widgets",			[](const RenderStats &s) { return (double)s.widgets; },			true},
+	{"glyphs",			[](const RenderStats &s) { return (double)s.glyphs; },			true}
+};
+
+// Same nearest-rank definition as RenderStatsHistory::getPercentile
+double	percentile(const std::vector<double> &sorted, double percent)
+{
+	if (sorted.empty())
+		return 0.0;
+
+	size_t rank = (size_t)std::ceil(percent * sorted.size() / 100.0);
+	rank = std::min(std::max(rank, (size_t)1), sorted.size()) - 1;
+	return sorted[rank];
+}
+
+bool	isWorkload(const std::string &group, const std::string &metric)
+{
+	// Single outliers, too noisy to gate on
+	if (group == "frameMs")
+		return metric == "min" || metric == "max";
+
+	for (const StatsCounter &counter : g_counters)
+		if (metric == counter.name)
+			return counter.workload;
+	return false;
+}
+
+const JsonValue	*findScenario(const JsonValue &report, const std::string &name)
+{
+	const JsonValue *scenarios = report.find("scenarios");
+
+	if (!scenarios)
+		return nullptr;
+	for (size_t i = 0; i < scenarios->getSize(); i++)
+	{
+		const JsonValue *scenarioName = scenarios->get(i).find("name");
+
+		if (scenarioName && scenarioName->getString() == name)
+			return &scenarios->get(i);
+	}
+	return nullptr;
+}
+
+// Lower is better for every metric of the report
+bool	compareMetric(const std::string &scenario, const std::string &group, const std::string &metric, double base, double head, double threshold, std::ostream &out)
+{
+	char	line[160];
+	char	delta[32];
+	bool	regression = false;
+
+	if (base == 0.0)
+		std::snprintf(delta, sizeof(delta), head == 0.0 ? "0.0%%" : "new");
+	else
+		std::snprintf(delta, sizeof(delta), "%+.1f%%", (head - base) / base * 100.0);
+
+	if (!isWorkload(group, metric))
+		regression = base == 0.0 ? head > 0.0 : (head - base) / base * 100.0 > threshold;
+
+	std::snprintf(line, sizeof(line), "%-14s %-24s %14.4f %14.4f %10s%s\n", scenario.c_str(), (group.empty() ? metric : group + "." + metric).c_str(),
+		base, head, delta, regression ? "  REGRESSION" : "");
+	out << line;
+	return regression;
+}
+
+unsigned int	compareGroup(const std::string &scenario, const std::string &group, const JsonValue &base, const JsonValue &head, double threshold, std::ostream &out)
+{
+	unsigned int regressions = 0;
+
+	for (const auto &member : head.getMembers())
+	{
+		const JsonValue *baseValue = base.find(member.first);
+
+		if (baseValue && baseValue->getType() == JsonValue::NUMBER && member.second.getType() == JsonValue::NUMBER)
+			regressions += compareMetric(scenario, group, member.first, baseValue->getNumber(), member.second.getNumber(), threshold, out);
+	}
+	return regressions;
+}
+
+}
+
+JsonValue ExoRendererBenchmarks::toJson(const ScenarioResult &result)
+{
+	JsonValue			scenario = JsonValue::object();
+	JsonValue			parameters = JsonValue::object();
+	JsonValue			frameMs = JsonValue::object();
+	JsonValue			stats = JsonValue::object();
+	std::vector<double>	sorted(result.frameTimes);
+	double				frames = (double)std::max(result.stats.size(), (size_t)1);
+
+	for (const auto &parameter : result.parameters)
+		parameters.set(parameter.first, parameter.second);
+
+	std::sort(sorted.begin(), sorted.end());
+	frameMs.set("mean", sorted.empty() ? 0.0 : std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size());
+	frameMs.set("min", sorted.empty() ? 0.0 : sorted.front());
+	frameMs.set("p50", percentile(sorted, 50));
+	frameMs.set("p90", percentile(sorted, 90));
+	frameMs.set("p95", percentile(sorted, 95));
+	frameMs.set("p99", percentile(sorted, 99));
+	frameMs.set("max", sorted.empty() ? 0.0 : sorted.back());
+
+	for (const StatsCounter &counter : g_counters)
+	{
+		double sum = 0.0;
+
+		for (const RenderStats &frame : result.stats)
+			sum += counter.get(frame);
+		stats.set(counter.name, sum / frames);
+	}
+	// Per frame, laying out and drawing text doesn't allocate once warmed up
+	stats.set("allocations", std::accumulate(result.allocations.begin(), result.allocations.end(), 0.0) / frames);
+
+	scenario.set("name", result.name);
+	scenario.set("parameters", parameters);
+	scenario.set("frames", (double)result.frameTimes.size());
+	scenario.set("setupMs", result.setupMs);
+	scenario.set("frameMs", frameMs);
+	scenario.set("stats", stats);
+	return scenario;
+}
+
+unsigned int ExoRendererBenchmarks::compareReports(const JsonValue &base, const JsonValue &head, double threshold, std::ostream &out)
+{
+	const JsonValue	*scenarios = head.find("scenarios");
+	unsigned int	regressions = 0;
+	char			line[160];
+
+	if (!scenarios)
+		return 0;
+
+	std::snprintf(line, sizeof(line), "%-14s %-24s %14s %14s %10s\n", "scenario", "metric", "base", "head", "delta");
+	out << line;
+
+	for (size_t i = 0; i < scenarios->getSize(); i++)
+	{
+		const JsonValue	&headScenario = scenarios->get(i);
+		const JsonValue	*name = headScenario.find("name");
+		const JsonValue	*baseScenario = name ? findScenario(base, name->getString()) : nullptr;
+
+		if (!name)
+			continue ;
+		if (!baseScenario)
+		{
+			out << name->getString() << ": missing from the base report, skipped\n";
+			continue ;
+		}
+
+		const JsonValue *baseParameters = baseScenario->find("parameters");
+		const JsonValue *headParameters = headScenario.find("parameters");
+		if (baseParameters && headParameters && baseParameters->dump() != headParameters->dump())
+			out << name->getString() << ": parameters differ, the numbers are not comparable\n";
+
+		const JsonValue *baseSetup = baseScenario->find("setupMs");
+		const JsonValue *headSetup = headScenario.find("setupMs");
+		if (baseSetup && headSetup)
+			regressions += compareMetric(name->getString(), "", "setupMs", baseSetup->getNumber(), headSetup->getNumber(), threshold, out);
+
+		for (const char *group : {"frameMs", "stats"})
+		{
+			const JsonValue *baseGroup = baseScenario->find(group);
+			const JsonValue *headGroup = headScenario.find(group);
+
+			if (baseGroup && headGroup)
+				regressions += compareGroup(name->getString(), group, *baseGroup, *headGroup, threshold, out);
+		}
+	}
+
+	out << regressions << " regression(s) above " << threshold << "%\n";
+	return regressions;
+}
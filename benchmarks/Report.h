@@ -0,0 +1,57 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "RenderStats.h"
+#include "Json.h"
+
+// Version of the JSON layout written by toJson()
+#define REPORT_VERSION	1
+
+namespace	ExoRendererBenchmarks
+{
+
+struct ScenarioResult
+{
+	std::string										name;
+	std::vector<std::pair<std::string, double>>		parameters;
+	double											setupMs;
+	std::vector<double>								frameTimes;	// Milliseconds, measured frames only
+	std::vector<uint64_t>							allocations;	// Operator new calls, measured frames only
+	std::vector<ExoRenderer::RenderStats>			stats;
+};
+
+// {name, parameters, setupMs, frameMs {mean, min, p50, ..., max}, stats {<counter>: per frame mean}}
+JsonValue		toJson(const ScenarioResult &result);
+
+// Prints every metric of the scenarios found in both reports, returns the
+// number of metrics which got worse by more than threshold percent
+unsigned int	compareReports(const JsonValue &base, const JsonValue &head, double threshold, std::ostream &out);
+
+}
@@ -0,0 +1,78 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "IRenderer.h"
+#include "Assets.h"
+
+namespace	ExoRendererBenchmarks
+{
+
+struct Parameter
+{
+	std::string	name;
+	double		value;
+	std::string	description;
+};
+
+// One repeatable workload: setup() fills the renderer queues, update() runs
+// once per frame before swap(), teardown() leaves the renderer empty again
+class Scenario
+{
+public:
+	Scenario(const std::string &name, const std::string &description);
+	virtual ~Scenario(void);
+
+	virtual void	setup(ExoRenderer::IRenderer &renderer, Assets &assets) = 0;
+	virtual void	update(ExoRenderer::IRenderer &renderer, unsigned int frame);
+	virtual void	teardown(ExoRenderer::IRenderer &renderer) = 0;
+
+	// Getters
+	const std::string				&getName(void) const;
+	const std::string				&getDescription(void) const;
+	const std::vector<Parameter>	&getParameters(void) const;
+	bool							isAllocationFree(void) const;	// A measured frame that allocates fails the run
+
+	// Setters
+	bool	setParameter(const std::string &name, double value);	// false if unknown
+protected:
+	void			addParameter(const std::string &name, double value, const std::string &description);
+	void			setAllocationFree(bool allocationFree);
+	unsigned int	getParameter(const std::string &name) const;
+private:
+	std::string				_name;
+	std::string				_description;
+	std::vector<Parameter>	_parameters;
+	bool					_allocationFree;
+};
+
+// Every scenario, in the order they run by default
+std::vector<std::unique_ptr<Scenario>>	createScenarios(void);
+
+}
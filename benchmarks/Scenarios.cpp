@@ -0,0 +1,603 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Scenario.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ExoRenderer;
+using namespace ExoRendererBenchmarks;
+
+// Scenario
+Scenario::Scenario(const std::string &name, const std::string &description)
+: _name(name), _description(description), _allocationFree(false)
+{ }
+
+Scenario::~Scenario(void)
+{ }
+
+void Scenario::update(IRenderer &renderer, unsigned int frame)
+{
+	(void)renderer;
+	(void)frame;
+}
+
+// Getters
+const std::string &Scenario::getName(void) const
+{
+	return _name;
+}
+
+const std::string &Scenario::getDescription(void) const
+{
+	return _description;
+}
+
+const std::vector<Parameter> &Scenario::getParameters(void) const
+{
+	return _parameters;
+}
+
+bool Scenario::isAllocationFree(void) const
+{
+	return _allocationFree;
+}
+
+// Setters
+bool Scenario::setParameter(const std::string &name, double value)
+{
+	for (Parameter &parameter : _parameters)
+	{
+		if (parameter.name == name)
+		{
+			parameter.value = value;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Private
+void Scenario::addParameter(const std::string &name, double value, const std::string &description)
+{
+	_parameters.push_back({name, value, description});
+}
+
+void Scenario::setAllocationFree(bool allocationFree)
+{
+	_allocationFree = allocationFree;
+}
+
+unsigned int Scenario::getParameter(const std::string &name) const
+{
+	for (const Parameter &parameter : _parameters)
+		if (parameter.name == name)
+			return (unsigned int)std::max(parameter.value, 0.0);
+	return 0;
+}
+
+namespace
+{
+
+// N sprites spread over K array textures, part of them outside the frustum
+class SpriteScenario : public Scenario
+{
+public:
+	SpriteScenario(void)
+	: Scenario("sprites", "Sprites spread over several array textures"), _pCamera(nullptr)
+	{
+		addParameter("count", 10000, "sprites");
+		addParameter("textures", 8, "array textures");
+		addParameter("layers", 4, "layers per array texture");
+		addParameter("size", 64, "layer width and height in pixels");
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		unsigned int	count = getParameter("count");
+		unsigned int	textures = std::max(getParameter("textures"), 1u);
+		unsigned int	layers = std::max(getParameter("layers"), 1u);
+		unsigned int	size = std::max(getParameter("size"), 1u);
+		Random			random(32);
+
+		for (unsigned int i = 0; i < textures; i++)
+		{
+			std::vector<std::string>	paths;
+
+			for (unsigned int layer = 0; layer < layers; layer++)
+				paths.push_back(assets.getTexturePath(size, size, i * layers + layer));
+			_textures.emplace_back(renderer.createArrayTexture(size, size, paths));
+		}
+
+		// The camera at z = 2 sees about [-2, 2], the sprites around it are culled
+		_pCamera = renderer.createCamera();
+		renderer.setCurrentCamera(_pCamera);
+
+		_sprites.reserve(count);
+		for (unsigned int i = 0; i < count; i++)
+		{
+			sprite	s(_textures[i % textures], nullptr, random.next() % layers);
+
+			s.position = glm::vec2(random.range(-2.5f, 2.5f), random.range(-2.5f, 2.5f));
+			s.scale = glm::vec2(random.range(0.05f, 0.2f));
+			s.angle = random.range(0.0f, 6.28f);
+			_sprites.push_back(s);
+			renderer.add(_sprites.back());
+		}
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		(void)frame;
+		_pCamera->update(renderer.getMouse(), renderer.getKeyboard(), renderer.getGamepadManager()->getGamepad(0));
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		for (sprite &s : _sprites)
+			renderer.remove(s);
+		_sprites.clear();
+		_textures.clear();
+
+		renderer.setCurrentCamera(nullptr);
+		delete _pCamera;
+		_pCamera = nullptr;
+	}
+private:
+	std::vector<std::shared_ptr<IArrayTexture>>	_textures;
+	std::vector<sprite>							_sprites;
+	ICamera										*_pCamera;
+};
+
+// M labels of L characters, static or rewritten every frame
+class TextScenario : public Scenario
+{
+public:
+	TextScenario(const std::string &name, bool dynamic)
+	: Scenario(name, dynamic ? "Labels whose text changes every frame" : "Static labels"), _dynamic(dynamic)
+	{
+		addParameter("count", 200, "labels");
+		addParameter("length", 64, "characters per label");
+		setAllocationFree(true);
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		unsigned int	count = getParameter("count");
+		unsigned int	length = getParameter("length");
+		Random			random(64);
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			ILabel		*label = renderer.createLabel();
+			std::string	text(length, ' ');
+
+			for (char &c : text)
+				c = (char)(33 + random.next() % 94);
+
+			label->setFont(assets.getFont(renderer));
+			label->setFontScale(0.5f);
+			label->setPosition(20.0f + (i / 40) * 8.0f, 20.0f + (i % 40) * 18.0f);
+			label->setText(text);
+			renderer.add(label);
+
+			_labels.push_back(label);
+			_texts.push_back(text);
+		}
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		(void)renderer;
+		if (!_dynamic)
+			return ;
+
+		// Rotated in place, so the only allocations left are the renderer's
+		for (size_t i = 0; i < _labels.size(); i++)
+		{
+			const std::string	&text = _texts[i];
+			size_t				shift = text.empty() ? 0 : frame % text.size();
+
+			_rotated.assign(text, shift, std::string::npos);
+			_rotated.append(text, 0, shift);
+			_labels[i]->setText(_rotated);
+		}
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		for (ILabel *label : _labels)
+		{
+			renderer.remove(label);
+			delete label;
+		}
+		_labels.clear();
+		_texts.clear();
+	}
+private:
+	bool						_dynamic;
+	std::vector<ILabel*>		_labels;
+	std::vector<std::string>	_texts;
+	std::string					_rotated;
+};
+
+// M static labels spread over views, placed again every frame the way views place the labels of their widgets
+class TextViewScenario : public Scenario
+{
+public:
+	TextViewScenario(void)
+	: Scenario("text-view", "Static labels inside views, placed again every frame")
+	{
+		addParameter("count", 200, "labels");
+		addParameter("views", 4, "views the labels are spread over");
+		addParameter("length", 16, "characters per label");
+		setAllocationFree(true);
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		unsigned int	count = getParameter("count");
+		unsigned int	views = std::max(getParameter("views"), 1u);
+		unsigned int	length = getParameter("length");
+		Random			random(96);
+
+		for (unsigned int i = 0; i < views; i++)
+		{
+			IView *view = renderer.createView(assets.getWidgetTexture(renderer), assets.getWidgetTexture(renderer));
+
+			view->setPosition(170.0f + i * 330.0f, 380.0f);
+			view->setSize(150.0f, 320.0f);
+			renderer.add(view);
+			_views.push_back(view);
+		}
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			ILabel		*label = renderer.createLabel();
+			std::string	text(length, ' ');
+
+			for (char &c : text)
+				c = (char)(33 + random.next() % 94);
+
+			label->setFont(assets.getFont(renderer));
+			label->setFontScale(0.25f);
+			label->setPosition(0.0f, 12.0f + (i / views) * 12.0f);
+			label->setText(text);
+			_views[i % views]->addChild(label);
+			_labels.push_back(label);
+		}
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		(void)renderer;
+		(void)frame;
+		for (ILabel *label : _labels)
+			label->contextInfo(label->getScaleFactor(), label->getContextWidth(), label->getContextHeight(), true);
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		for (IView *view : _views)
+		{
+			renderer.remove(view);
+			delete view;
+		}
+		for (ILabel *label : _labels)
+			delete label;
+		_views.clear();
+		_labels.clear();
+	}
+private:
+	std::vector<IView*>		_views;
+	std::vector<ILabel*>	_labels;
+};
+
+// Nested views of buttons, inputs and selects, updated like a menu every frame
+class GUIScenario : public Scenario
+{
+public:
+	GUIScenario(void)
+	: Scenario("gui", "Nested views of buttons, inputs and selects")
+	{
+		addParameter("views", 4, "top level views");
+		addParameter("depth", 2, "views nested in each top level view");
+		addParameter("widgets", 6, "buttons, inputs and selects per view, of each kind");
+		addParameter("options", 8, "options per select");
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		unsigned int views = getParameter("views");
+
+		for (unsigned int i = 0; i < views; i++)
+		{
+			IView *view = renderer.createView(assets.getWidgetTexture(renderer), assets.getWidgetTexture(renderer));
+
+			view->setPosition(170.0f + i * 330.0f, 380.0f);
+			view->setSize(150.0f, 320.0f);
+			renderer.add(view);
+			_views.push_back(view);
+			_widgets.push_back(view);
+
+			fill(renderer, assets, view, getParameter("depth"));
+		}
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		(void)frame;
+		for (IView *view : _views)
+			view->update(renderer.getMouse(), renderer.getKeyboard(), renderer.getGamepadManager()->getGamepad(0), renderer.getNavigationType());
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		for (IView *view : _views)
+			renderer.remove(view);
+		for (IWidget *widget : _widgets)
+			delete widget;
+		_views.clear();
+		_widgets.clear();
+	}
+private:
+	void	fill(IRenderer &renderer, Assets &assets, IView *view, unsigned int depth)
+	{
+		const std::shared_ptr<ITexture>	&texture = assets.getWidgetTexture(renderer);
+		const std::shared_ptr<Font>		&font = assets.getFont(renderer);
+		unsigned int					widgets = getParameter("widgets");
+		unsigned int					options = getParameter("options");
+		float							y = 30.0f;
+
+		for (unsigned int i = 0; i < widgets; i++)
+		{
+			IButton	*button = renderer.createButton(texture);
+			IInput	*input = renderer.createInput(texture, "input " + std::to_string(i));
+			ISelect	*select = renderer.createSelect(texture, texture, texture, font);
+
+			button->setSliced(true);
+			button->setFont(font);
+			button->setText("button " + std::to_string(i));
+			button->setTextScale(0.3f);
+			button->setSize(120.0f, 16.0f);
+			button->setPosition(0.0f, y);
+			view->addChild(button);
+			y += 40.0f;
+
+			input->setSliced(true);
+			input->setFont(font);
+			input->setTextScale(0.3f);
+			input->setSize(120.0f, 16.0f);
+			input->setPosition(0.0f, y);
+			view->addChild(input);
+			y += 40.0f;
+
+			select->setSize(120.0f, 16.0f);
+			select->setPosition(0.0f, y);
+			for (unsigned int option = 0; option < options; option++)
+				select->addOption(new ISelect::Option({std::to_string(option), "option " + std::to_string(option)}), option == 0);
+			view->addChild(select);
+			y += 40.0f;
+
+			_widgets.push_back(button);
+			_widgets.push_back(input);
+			_widgets.push_back(select);
+		}
+
+		if (depth == 0)
+			return ;
+
+		// Positioned by addChild, so it is filled afterwards
+		IView *child = renderer.createView(texture, texture);
+
+		child->setSize(130.0f, 120.0f);
+		child->setPosition(0.0f, y + 120.0f);
+		view->addChild(child);
+		_widgets.push_back(child);
+
+		fill(renderer, assets, child, depth - 1);
+	}
+
+	std::vector<IView*>		_views;
+	std::vector<IWidget*>	_widgets;
+};
+
+// Texture files decoded and uploaded every frame, then released
+class TextureScenario : public Scenario
+{
+public:
+	TextureScenario(void)
+	: Scenario("textures", "Texture loading")
+	{
+		addParameter("count", 4, "textures loaded per frame");
+		addParameter("size", 256, "texture width and height in pixels");
+		addParameter("variants", 16, "distinct files cycled through");
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		unsigned int	size = std::max(getParameter("size"), 1u);
+		unsigned int	variants = std::max(getParameter("variants"), 1u);
+
+		(void)renderer;
+		for (unsigned int i = 0; i < variants; i++)
+			_paths.push_back(assets.getTexturePath(size, size, 2000 + i));
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		unsigned int count = getParameter("count");
+
+		for (unsigned int i = 0; i < count; i++)
+			delete renderer.createTexture(_paths[(frame * count + i) % _paths.size()]);
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		(void)renderer;
+		_paths.clear();
+	}
+private:
+	std::vector<std::string>	_paths;
+};
+
+// Font descriptors parsed every frame, text (binary=0) or binary (binary=1)
+class FontScenario : public Scenario
+{
+public:
+	FontScenario(void)
+	: Scenario("fonts", "BMFont descriptor loading"), _glyphs(0)
+	{
+		addParameter("count", 1, "descriptors loaded per frame");
+		addParameter("glyphs", 20000, "glyphs and kerning pairs per descriptor");
+		addParameter("binary", 0, "load the binary descriptor instead of the text one");
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		(void)renderer;
+		_path = assets.getFontPath(std::max(getParameter("glyphs"), 1u), getParameter("binary") != 0);
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		unsigned int count = getParameter("count");
+
+		(void)renderer;
+		(void)frame;
+		for (unsigned int i = 0; i < count; i++)
+		{
+			FntLoader loader(_path);
+
+			_glyphs += loader.getGlyphCount();
+		}
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		(void)renderer;
+		_path.clear();
+	}
+private:
+	std::string	_path;
+	size_t		_glyphs;	// Keeps the loads from being optimized out
+};
+
+// Large textures drawn far smaller than their size by a zoomed out camera.
+// Compare filter=1 (LINEAR, base level only) with filter=2 (TRILINEAR) to see
+// the texture bandwidth saved by the mip chain.
+class ZoomScenario : public Scenario
+{
+public:
+	ZoomScenario(void)
+	: Scenario("zoom-out", "Minified sprites, texture bandwidth per filter"), _pCamera(nullptr)
+	{
+		addParameter("count", 4096, "sprites, on a square grid");
+		addParameter("textures", 2, "array textures");
+		addParameter("layers", 4, "layers per array texture");
+		addParameter("size", 1024, "layer width and height in pixels");
+		addParameter("zoom", 16, "camera distance, as a multiple of the default one");
+		addParameter("filter", TextureFilter::TRILINEAR, "0 nearest, 1 linear, 2 trilinear, 3 anisotropic");
+	}
+
+	virtual void	setup(IRenderer &renderer, Assets &assets)
+	{
+		unsigned int	textures = std::max(getParameter("textures"), 1u);
+		unsigned int	layers = std::max(getParameter("layers"), 1u);
+		unsigned int	size = std::max(getParameter("size"), 1u);
+		unsigned int	side = std::max((unsigned int)std::sqrt((double)getParameter("count")), 1u);
+		float			extent = 2.0f * std::max(getParameter("zoom"), 1u);
+		TextureFilter	filter = (TextureFilter)std::min(getParameter("filter"), (unsigned int)TextureFilter::ANISOTROPIC);
+
+		for (unsigned int i = 0; i < textures; i++)
+		{
+			std::vector<std::string>	paths;
+
+			for (unsigned int layer = 0; layer < layers; layer++)
+				paths.push_back(assets.getTexturePath(size, size, 3000 + i * layers + layer));
+			_textures.emplace_back(renderer.createArrayTexture(size, size, paths, filter));
+		}
+
+		// Backed away from the sprites, which fill the view
+		_pCamera = renderer.createCamera();
+		_pCamera->setPosition(0.0f, 0.0f, extent);
+		renderer.setCurrentCamera(_pCamera);
+
+		_sprites.reserve(side * side);
+		for (unsigned int y = 0; y < side; y++)
+		{
+			for (unsigned int x = 0; x < side; x++)
+			{
+				unsigned int	i = y * side + x;
+				float			cell = 2.0f * extent / side;
+				sprite			s(_textures[i % textures], nullptr, (i / textures) % layers);
+
+				s.position = glm::vec2(-extent + (x + 0.5f) * cell, -extent + (y + 0.5f) * cell);
+				s.scale = glm::vec2(cell * 0.5f);
+				_sprites.push_back(s);
+				renderer.add(_sprites.back());
+			}
+		}
+	}
+
+	virtual void	update(IRenderer &renderer, unsigned int frame)
+	{
+		(void)frame;
+		_pCamera->update(renderer.getMouse(), renderer.getKeyboard(), renderer.getGamepadManager()->getGamepad(0));
+	}
+
+	virtual void	teardown(IRenderer &renderer)
+	{
+		for (sprite &s : _sprites)
+			renderer.remove(s);
+		_sprites.clear();
+		_textures.clear();
+
+		renderer.setCurrentCamera(nullptr);
+		delete _pCamera;
+		_pCamera = nullptr;
+	}
+private:
+	std::vector<std::shared_ptr<IArrayTexture>>	_textures;
+	std::vector<sprite>							_sprites;
+	ICamera										*_pCamera;
+};
+
+}
+
+std::vector<std::unique_ptr<Scenario>> ExoRendererBenchmarks::createScenarios(void)
+{
+	std::vector<std::unique_ptr<Scenario>>	scenarios;
+
+	scenarios.emplace_back(new SpriteScenario());
+	scenarios.emplace_back(new TextScenario("text", false));
+	scenarios.emplace_back(new TextScenario("text-dynamic", true));
+	scenarios.emplace_back(new TextViewScenario());
+	scenarios.emplace_back(new GUIScenario());
+	scenarios.emplace_back(new TextureScenario());
+	scenarios.emplace_back(new FontScenario());
+	scenarios.emplace_back(new ZoomScenario());
+	return scenarios;
+}
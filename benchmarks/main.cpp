@@ -0,0 +1,329 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <GL/glew.h>
+
+#include "RendererSDLOpenGL.h"
+#include "Scenario.h"
+#include "Report.h"
+#include "Allocations.h"
+
+using namespace ExoRenderer;
+using namespace ExoRendererSDLOpenGL;
+using namespace ExoRendererBenchmarks;
+
+namespace
+{
+
+struct Options
+{
+	unsigned int								frames = 300;
+	unsigned int								warmup = 30;
+	int											width = 1280;
+	int											height = 720;
+	bool										windowed = false;
+	bool										list = false;
+	bool										help = false;
+	std::string									output;
+	std::vector<std::string>					scenarios;
+	std::vector<std::pair<std::string, double>>	parameters;	// "<scenario>.<parameter>"
+	std::string									compareBase;
+	std::string									compareHead;
+	double										threshold = 5.0;
+};
+
+void	usage(void)
+{
+	std::cerr << "usage: benchmarks [options]\n"
+		<< "       benchmarks --compare <base.json> <head.json> [--threshold <percent>]\n\n"
+		<< "  --frames <n>                measured frames per scenario (300)\n"
+		<< "  --warmup <n>                frames run before measuring (30)\n"
+		<< "  --width <n>, --height <n>   context size (1280 x 720)\n"
+		<< "  --scenario <name>           run only this scenario, repeatable\n"
+		<< "  --set <scenario.param=v>    override a scenario parameter, repeatable\n"
+		<< "  --output <file>             write the JSON report there instead of stdout\n"
+		<< "  --window                    render to a window instead of headless\n"
+		<< "  --list                      list the scenarios and their parameters\n"
+		<< "  --threshold <percent>       --compare: slowdown reported as a regression (5)\n";
+}
+
+std::string	readFile(const std::string &path)
+{
+	std::ifstream		file(path);
+	std::stringstream	content;
+
+	if (!file)
+		throw (std::runtime_error("cannot open " + path));
+	content << file.rdbuf();
+	return content.str();
+}
+
+Options	parseOptions(int argc, char **argv)
+{
+	Options	options;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string	arg(argv[i]);
+		auto		next = [&](void) -> std::string {
+			if (i + 1 >= argc)
+				throw (std::invalid_argument(arg + " expects a value"));
+			return argv[++i];
+		};
+
+		if (arg == "--frames")
+			options.frames = std::stoul(next());
+		else if (arg == "--warmup")
+			options.warmup = std::stoul(next());
+		else if (arg == "--width")
+			options.width = std::stoi(next());
+		else if (arg == "--height")
+			options.height = std::stoi(next());
+		else if (arg == "--scenario")
+			options.scenarios.push_back(next());
+		else if (arg == "--output")
+			options.output = next();
+		else if (arg == "--window")
+			options.windowed = true;
+		else if (arg == "--list")
+			options.list = true;
+		else if (arg == "--help" || arg == "-h")
+			options.help = true;
+		else if (arg == "--threshold")
+			options.threshold = std::stod(next());
+		else if (arg == "--set")
+		{
+			std::string	value = next();
+			size_t		equal = value.find('=');
+
+			if (equal == std::string::npos || value.find('.') > equal)
+				throw (std::invalid_argument("--set expects <scenario>.<parameter>=<value>"));
+			options.parameters.emplace_back(value.substr(0, equal), std::stod(value.substr(equal + 1)));
+		}
+		else if (arg == "--compare")
+		{
+			options.compareBase = next();
+			options.compareHead = next();
+		}
+		else
+			throw (std::invalid_argument("unknown option " + arg));
+	}
+
+	if (options.frames == 0)
+		throw (std::invalid_argument("--frames must be at least 1"));
+	return options;
+}
+
+double	elapsedMs(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+ScenarioResult	run(IRenderer &renderer, Assets &assets, Scenario &scenario, const Options &options)
+{
+	ScenarioResult							result;
+	std::chrono::steady_clock::time_point	start;
+
+	result.name = scenario.getName();
+	for (const Parameter &parameter : scenario.getParameters())
+		result.parameters.emplace_back(parameter.name, parameter.value);
+
+	start = std::chrono::steady_clock::now();
+	scenario.setup(renderer, assets);
+	glFinish();
+	result.setupMs = elapsedMs(start);
+
+	result.frameTimes.reserve(options.frames);
+	result.stats.reserve(options.frames);
+	result.allocations.reserve(options.frames);
+	for (unsigned int frame = 0; frame < options.warmup + options.frames; frame++)
+	{
+		uint64_t allocations = getAllocationCount();
+
+		start = std::chrono::steady_clock::now();
+		scenario.update(renderer, frame);
+		renderer.swap();
+		// The GPU (llvmpipe threads included) has to be done with the frame too
+		glFinish();
+		allocations = getAllocationCount() - allocations;
+
+		if (frame < options.warmup)
+			continue ;
+		result.frameTimes.push_back(elapsedMs(start));
+		result.stats.push_back(renderer.getStats());
+		result.allocations.push_back(allocations);
+	}
+
+	scenario.teardown(renderer);
+	return result;
+}
+
+// Scenarios whose frames must not allocate once warmed up, the text path among them
+bool	checkAllocations(const Scenario &scenario, const ScenarioResult &result)
+{
+	if (!scenario.isAllocationFree())
+		return true;
+	for (size_t frame = 0; frame < result.allocations.size(); frame++)
+	{
+		if (result.allocations[frame] != 0)
+		{
+			std::cerr << "benchmarks: " << scenario.getName() << " allocated " << result.allocations[frame]
+				<< " times in measured frame " << frame << ", expected none" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+int	compare(const Options &options)
+{
+	JsonValue	base = JsonValue::parse(readFile(options.compareBase));
+	JsonValue	head = JsonValue::parse(readFile(options.compareHead));
+
+	return compareReports(base, head, options.threshold, std::cout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+}
+
+int	main(int argc, char **argv)
+{
+	Options									options;
+	std::vector<std::unique_ptr<Scenario>>	scenarios = createScenarios();
+	JsonValue								report = JsonValue::object();
+	JsonValue								results = JsonValue::array();
+	bool									allocationFree = true;
+
+	try
+	{
+		options = parseOptions(argc, argv);
+
+		for (const auto &parameter : options.parameters)
+		{
+			size_t	dot = parameter.first.find('.');
+			bool	found = false;
+
+			for (auto &scenario : scenarios)
+				if (scenario->getName() == parameter.first.substr(0, dot))
+					found = scenario->setParameter(parameter.first.substr(dot + 1), parameter.second);
+			if (!found)
+				throw (std::invalid_argument("unknown parameter " + parameter.first));
+		}
+		for (const std::string &name : options.scenarios)
+		{
+			bool found = false;
+
+			for (auto &scenario : scenarios)
+				found = found || scenario->getName() == name;
+			if (!found)
+				throw (std::invalid_argument("unknown scenario " + name));
+		}
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "benchmarks: " << e.what() << "\n\n";
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	if (options.help)
+	{
+		usage();
+		return EXIT_SUCCESS;
+	}
+
+	if (options.list)
+	{
+		for (auto &scenario : scenarios)
+		{
+			std::cout << scenario->getName() << ": " << scenario->getDescription() << "\n";
+			for (const Parameter &parameter : scenario->getParameters())
+				std::cout << "  " << scenario->getName() << "." << parameter.name << " = " << parameter.value << "  (" << parameter.description << ")\n";
+		}
+		return EXIT_SUCCESS;
+	}
+
+	try
+	{
+		if (!options.compareBase.empty())
+			return compare(options);
+
+		RendererSDLOpenGL	&renderer = RendererSDLOpenGL::Get();
+
+		renderer.initialize("Exo-Renderer benchmarks", options.width, options.height, options.windowed ? WindowMode::WINDOWED : WindowMode::HEADLESS, false);
+		renderer.getWindow()->setVsync(false);
+
+		{
+			Assets assets;
+
+			for (auto &scenario : scenarios)
+			{
+				if (!options.scenarios.empty() && std::find(options.scenarios.begin(), options.scenarios.end(), scenario->getName()) == options.scenarios.end())
+					continue ;
+
+				std::cerr << "running " << scenario->getName() << "..." << std::endl;
+				ScenarioResult result = run(renderer, assets, *scenario, options);
+				allocationFree = checkAllocations(*scenario, result) && allocationFree;
+				results.push(toJson(result));
+			}
+		}
+
+		report.set("version", REPORT_VERSION);
+		report.set("frames", options.frames);
+		report.set("warmup", options.warmup);
+		report.set("width", options.width);
+		report.set("height", options.height);
+		report.set("headless", JsonValue::boolean(!options.windowed));
+		report.set("scenarios", results);
+
+		RendererSDLOpenGL::Destroy();
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "benchmarks: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (options.output.empty())
+		std::cout << report.dump(2) << std::endl;
+	else
+	{
+		std::ofstream file(options.output);
+
+		file << report.dump(2) << std::endl;
+		if (!file)
+		{
+			std::cerr << "benchmarks: cannot write " << options.output << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	return allocationFree ? EXIT_SUCCESS : EXIT_FAILURE;
+}
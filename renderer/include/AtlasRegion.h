@@ -0,0 +1,62 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ITexture.h"
+
+namespace	ExoRenderer
+{
+
+// A rectangle of an atlas page, binds the page and samples only its rectangle.
+// Width and height are the ones of the packed image.
+class AtlasRegion : public ITexture
+{
+public:
+	AtlasRegion(const std::shared_ptr<ITexture> &page, int x, int y, int width, int height);
+	virtual ~AtlasRegion(void);
+
+	virtual void bind(int unit = 0) const;
+	virtual void unbind(void) const;
+
+	// Getters
+	virtual int getEngineId(void) const;
+	virtual int getWidth(void) const;
+	virtual int getHeight(void) const;
+	virtual bool isResident(void) const;
+	virtual glm::vec4 getUVRect(void) const;
+	const std::shared_ptr<ITexture> &getPage(void) const;
+
+	// Setters, for the whole page
+	virtual void setLodBias(float bias);
+	virtual void setLodRange(float minLod, float maxLod);
+private:
+	std::shared_ptr<ITexture>	_pPage;
+	int							_x, _y;
+	int							_width, _height;
+};
+
+}
@@ -56,13 +56,35 @@ enum TextureFilter
 {
 	NEAREST,
 	LINEAR,
+	TRILINEAR,		// Mipmapped, blended between levels
+	ANISOTROPIC,	// TRILINEAR with anisotropic filtering where supported
 };
 
 enum TextureFormat
 {
 	RGB,
 	RGBA,
-	DEPTH
+	DEPTH,
+	RED		// Single channel, glyph coverage
+};
+
+// What the font atlas holds
+enum FontType
+{
+	FONT_BITMAP,	// Coverage in the red channel
+	FONT_SDF,		// Signed distance in the red channel
+	FONT_MSDF,		// Multi-channel signed distance, the median of red, green and blue
+	FONT_TYPE_MAX
+};
+
+// GPU memory, see MemoryReport
+enum MemoryCategory
+{
+	MEMORY_TEXTURES,
+	MEMORY_ARRAY_TEXTURES,
+	MEMORY_BUFFERS,
+	MEMORY_FRAME_BUFFERS,	// Textures attached to a frame buffer
+	MEMORY_CATEGORY_MAX
 };
 
 // Window
@@ -70,7 +92,8 @@ enum WindowMode
 {
 	WINDOWED = 0,
 	FULLSCREEN,
-	BORDERLESS
+	BORDERLESS,
+	HEADLESS	// No display, renders offscreen only
 };
 
 // Inputs
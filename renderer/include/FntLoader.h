@@ -24,9 +24,21 @@
 
 #pragma once
 
-#include <iostream>
-#include <fstream>
-#include <sstream>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+#include "Enums.h"
+
+// Code points per page of the glyph table
+#define FNT_PAGE_SIZE		256
+// Pages looked up directly, the Basic Multilingual Plane
+#define FNT_DIRECT_PAGES	256
+// Glyphs a page needs to be stored densely, sparser ones go to the hash
+#define FNT_DENSE_GLYPHS	16
 
 namespace	ExoRenderer
 {
@@ -41,115 +53,69 @@ struct CharDescriptor
 	float xMaxTextureCoord, yMaxTextureCoord;
 
 	CharDescriptor()
-	: x(0), y(0), width(0), height( 0 ), xOffset( 0 ), yOffset( 0 ), xAdvance(0)
+	: x(0), y(0), width(0), height( 0 ), xOffset( 0 ), yOffset( 0 ), xAdvance(0), xMaxTextureCoord(0), yMaxTextureCoord(0)
 	{ }
 };
 
+// BMFont descriptor, text or binary (version 3). Glyphs are found in two steps: a page of FNT_PAGE_SIZE
+// code points, dense when the font covers enough of it, then the glyph in the page.
+// Code points of the other pages are hashed.
 class FntLoader
 {
 public:
-	FntLoader(const std::string& path)
-	: _width(0), _height(0)
+	FntLoader(const std::string& path);
+	virtual ~FntLoader(void);
+
+	// Empty glyph when the font doesn't have it
+	inline const CharDescriptor &getCharacter(uint32_t character) const
 	{
-		std::filebuf fb;
-		if (fb.open(path.c_str(), std::ios::in))
+		if (character < FNT_DIRECT_PAGES * FNT_PAGE_SIZE)
 		{
-			std::istream is(&fb);
-			while (is)
-				parseFont(is);
+			const std::unique_ptr<CharDescriptor[]> &page = _pages[character / FNT_PAGE_SIZE];
 
-			fb.close();
+			if (page)
+				return page[character % FNT_PAGE_SIZE];
 		}
-	}
 
-	virtual ~FntLoader(void)
-	{ }
+		auto iterator = _sparse.find(character);
+		return iterator == _sparse.end() ? _missing : iterator->second;
+	}
 
-	inline CharDescriptor getCharacter(unsigned char character) const { return _chars[character]; }
-private:
-	void parseFont(std::istream& stream)
+	// Added to the advance of first when second follows it
+	inline float getKerning(uint32_t first, uint32_t second) const
 	{
-		std::string line;
-		std::string read, key, value;
-		std::size_t i;
+		if (_kerning.empty())
+			return 0.0f;
 
-		while(!stream.eof())
-		{
-			std::stringstream lineStream;
-			std::getline(stream, line);
-
-			lineStream << line;
-			lineStream >> read;
-
-			if(read == "common")
-			{
-				// Read the line
-				while(!lineStream.eof())
-				{
-					std::stringstream converter;
-					lineStream >> read;
-					i = read.find( '=' );
-
-					// Split string (key=value)
-					key = read.substr( 0, i );
-					value = read.substr( i + 1 );
-
-					converter << value;
-					if(key == "lineHeight")
-						converter >> _lineHeight;
-					else if(key == "base")
-						converter >> _base;
-					else if(key == "scaleW")
-						converter >> _width;
-					else if(key == "scaleH")
-						converter >> _height;
-				}
-			}
-			else if(read == "char")
-			{
-				unsigned int charId = 0;
-
-				while(!lineStream.eof())
-				{
-					std::stringstream converter;
-					lineStream >> read;
-					i = read.find( '=' );
-
-					// Split string (key=value)
-					key = read.substr( 0, i );
-					value = read.substr( i + 1 );
-
-					converter << value;
-					if(key == "id")
-						converter >> charId;
-					else if(key == "x")
-						converter >> _chars[charId].x;
-					else if(key == "y")
-						converter >> _chars[charId].y;
-					else if(key == "width")
-						converter >> _chars[charId].width;
-					else if(key == "height")
-						converter >> _chars[charId].height;
-					else if(key == "xoffset")
-						converter >> _chars[charId].xOffset;
-					else if(key == "yoffset")
-						converter >> _chars[charId].yOffset;
-					else if(key == "xadvance")
-						converter >> _chars[charId].xAdvance;
-				}
-
-				_chars[charId].xMaxTextureCoord = (_chars[charId].width + _chars[charId].x) / _width;
-				_chars[charId].yMaxTextureCoord = (_chars[charId].height + _chars[charId].y) / _height;
-				_chars[charId].x /= _width;
-				_chars[charId].y /= _height;
-			}
-		}
+		auto iterator = _kerning.find(((uint64_t)first << 32) | second);
+		return iterator == _kerning.end() ? 0.0f : iterator->second;
 	}
+
+	// Getters
+	size_t		getGlyphCount(void) const;
+	size_t		getKerningCount(void) const;
+	FontType	getType(void) const;			// From the distanceField line of text descriptors
+	float		getDistanceRange(void) const;	// Atlas pixels, distance fields only
+private:
+	typedef std::vector<std::pair<uint32_t, CharDescriptor>>	GlyphList;
+
+	// Straight from the mapped file, without copying it
+	void	parseText(const char* data, size_t size, GlyphList& glyphs);
+	void	parseBinary(const unsigned char* data, size_t size, GlyphList& glyphs);
+	void	addGlyph(GlyphList& glyphs, uint32_t id, CharDescriptor& character) const;	// Pixels to texture coordinates
+	void	buildPages(const GlyphList& glyphs);
 private:
 	unsigned short _lineHeight;
 	unsigned short _base;
 	float _width, _height;
-	CharDescriptor _chars[256];
+	FontType _type;
+	float _distanceRange;
+
+	std::unique_ptr<CharDescriptor[]>			_pages[FNT_DIRECT_PAGES];	// Null for the sparse pages
+	std::unordered_map<uint32_t, CharDescriptor>	_sparse;
+	std::unordered_map<uint64_t, float>			_kerning;	// first << 32 | second
+	CharDescriptor								_missing;
+	size_t										_glyphCount;
 };
 
 }
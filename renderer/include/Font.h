@@ -27,8 +27,14 @@
 #include "FntLoader.h"
 #include "ITexture.h"
 #include "IResource.h"
+#include "Enums.h"
 
 #include <memory>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+// Distance range assumed for distance field fonts whose descriptor doesn't say, in atlas pixels
+#define FONT_DISTANCE_RANGE	4.0f
 
 namespace	ExoRenderer
 {
@@ -37,24 +43,55 @@ class Font : public ExoEngine::IResource
 {
 public:
 	Font(void)
+	: _type(FONT_BITMAP), _distanceRange(FONT_DISTANCE_RANGE), _outlineColor(0.0f), _outlineWidth(0.0f), _shadowColor(0.0f), _shadowOffset(0.0f)
 	{ }
 
 	Font(const std::shared_ptr<FntLoader>& loader, const std::shared_ptr<ITexture>& texture)
+	: _outlineColor(0.0f), _outlineWidth(0.0f), _shadowColor(0.0f), _shadowOffset(0.0f)
 	{
-		_pLoader = loader;
+		setFont(loader);
 		_pTexture = texture;
 	}
 
 	virtual ~Font(void)
 	{ }
 
+	// Glyphs of the descriptor, a DynamicFont rasterises them instead
+	virtual const CharDescriptor& getCharacter(uint32_t character) const { return _pLoader->getCharacter(character); }
+	virtual float getKerning(uint32_t first, uint32_t second) const { return _pLoader->getKerning(first, second); }
+	// Changes whenever glyphs already handed out may have changed, labels are then laid out again
+	virtual unsigned int getGeneration() const { return 0; }
+	// Atlas pages as bits: the one holding a glyph, and marking pages as drawn this frame.
+	// A DynamicFont evicts the page least recently drawn, the others have a single page.
+	virtual uint32_t getPages(uint32_t character) const { (void)character; return 0; }
+	virtual void touch(uint32_t pages) const { (void)pages; }
+
 	// Getters
 	const std::shared_ptr<FntLoader>& getFont() const { return _pLoader; }
 	const std::shared_ptr<ITexture>& getTexture() const { return _pTexture; }
+	FontType getType() const { return _type; }
+	float getDistanceRange() const { return _distanceRange; }
+	const glm::vec4& getOutlineColor() const { return _outlineColor; }
+	float getOutlineWidth() const { return _outlineWidth; }
+	const glm::vec4& getShadowColor() const { return _shadowColor; }
+	const glm::vec2& getShadowOffset() const { return _shadowOffset; }
 
 	// Setters
-	void setFont(const std::shared_ptr<FntLoader>& loader) { _pLoader = loader; }
+	// The type comes from the descriptor, see FntLoader::getType
+	void setFont(const std::shared_ptr<FntLoader>& loader)
+	{
+		_pLoader = loader;
+		_type = loader ? loader->getType() : FONT_BITMAP;
+		_distanceRange = loader && loader->getDistanceRange() > 0 ? loader->getDistanceRange() : FONT_DISTANCE_RANGE;
+	}
 	void setTexture(const std::shared_ptr<ITexture>& texture) { _pTexture = texture; };
+	void setType(FontType type, float distanceRange = FONT_DISTANCE_RANGE) { _type = type; _distanceRange = distanceRange; }
+
+	// Drawn in the same pass as the glyphs, widths and offsets in atlas pixels. The outline
+	// grows the glyphs by up to half the distance range, bitmap fonts have no outline.
+	// A transparent color disables them.
+	void setOutline(const glm::vec4& color, float width) { _outlineColor = color; _outlineWidth = width; }
+	void setShadow(const glm::vec4& color, const glm::vec2& offset) { _shadowColor = color; _shadowOffset = offset; }
 
 	// Operators
 	inline bool operator== (const Font& font) const
@@ -75,6 +112,13 @@ public:
 private:
 	std::shared_ptr<FntLoader> _pLoader;
 	std::shared_ptr<ITexture>	_pTexture;
+
+	FontType	_type;
+	float		_distanceRange;
+	glm::vec4	_outlineColor;
+	float		_outlineWidth;
+	glm::vec4	_shadowColor;
+	glm::vec2	_shadowOffset;
 };
 
 }
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "Enums.h"
@@ -45,6 +46,22 @@ public:
 
 	virtual void bind(int unit = 0) const = 0;
 	virtual void unbind() const = 0;
+
+	// Layers, the sprites keep their layer index as the array grows
+	virtual int  appendLayer(const std::string& filePath) = 0;	// Index of the new layer
+	virtual void replaceLayer(int layer, const std::string& filePath) = 0;
+	virtual void reserve(int capacity) = 0;
+
+	// Getters
+	virtual int getLayerCount(void) const = 0;
+	virtual int getCapacity(void) const = 0;
+	// GPU memory it allocated, the reserved layers and mip levels included
+	virtual uint64_t getAllocatedBytes(void) const { return 0; }
+
+	// Setters
+	// Mip level selection, effective with the TRILINEAR and ANISOTROPIC filters
+	virtual void setLodBias(float bias) = 0;
+	virtual void setLodRange(float minLod, float maxLod) = 0;
 };
 
 }
@@ -29,6 +29,7 @@
 #include <glm/vec4.hpp>
 
 #include "Font.h"
+#include "TextLayout.h"
 #include "anchorPoint.h"
 #include "textAlignment.h"
 
@@ -48,10 +49,12 @@ public:
 	virtual void updateGlyph() = 0;
 
 	// Getters
-	virtual std::string getText(void) const = 0;
+	virtual const std::string& getText(void) const = 0;
 	virtual glm::vec3 getColor(void) const = 0;
 	virtual glm::vec2 getGlyphLayout(void) const = 0;
 	virtual const std::shared_ptr<Font>& getFont(void) = 0;
+	// Laid out lines of the text with their width, the renderers draw them as they are
+	virtual const std::vector<TextLine>& getLines(void) = 0;
 	virtual float getFontScale(void) const = 0;
 	virtual TextAlignment getTextAlignment(void) const = 0;
 
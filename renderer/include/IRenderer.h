@@ -36,6 +36,7 @@
 #include "IShader.h"
 #include "ITexture.h"
 #include "IArrayTexture.h"
+#include "ITextureAtlas.h"
 #include "IWidget.h"
 #include "IButton.h"
 #include "ICheckbox.h"
@@ -51,6 +52,10 @@
 #include "sprite.h"
 #include "MousePicker.h"
 #include "IAxis.h"
+#include "GPUPass.h"
+#include "RenderStats.h"
+#include "MemoryReport.h"
+#include "TextureCache.h"
 
 namespace	ExoRenderer
 {
@@ -71,7 +76,12 @@ public:
 	virtual IAxis			*createAxis(void) = 0;
 	virtual ITexture		*createTexture(const std::string& filePath, TextureFilter filter = TextureFilter::LINEAR) = 0;
 	virtual ITexture		*createTexture(unsigned int width, unsigned int height, TextureFormat format = TextureFormat::RGBA, TextureFilter filter = TextureFilter::LINEAR) = 0;
+	// Returns at once, decoded in the background and drawn as a placeholder until isResident()
+	virtual ITexture		*createTextureAsync(const std::string& filePath, TextureFilter filter = TextureFilter::LINEAR) = 0;
 	virtual IArrayTexture	*createArrayTexture(int width, int height, std::vector<std::string> &textures, TextureFilter filter = TextureFilter::LINEAR) = 0;
+	virtual ITextureAtlas	*createTextureAtlas(int pageSize = TEXTURE_ATLAS_PAGE_SIZE, int padding = TEXTURE_ATLAS_PADDING, TextureFilter filter = TextureFilter::LINEAR) = 0;
+	// Glyphs rasterised from a TrueType file as labels need them, size in pixels
+	virtual Font			*createDynamicFont(const std::string& filePath, unsigned int size) = 0;
 
 	virtual ICursor		 *createCursor() = 0;
 	virtual ILabel			*createLabel() = 0;
@@ -89,6 +99,19 @@ public:
 	virtual ILight			*createPointLight(const glm::vec3 &ambient, const glm::vec3 &diffuse, const glm::vec3 &pos, const glm::vec3 &dir, const glm::vec3 &up, const float &fovy, const float &aspect, const float &near, const float &far) = 0;
 	virtual IFrameBuffer	*createFrameBuffer(void) = 0;
 
+	// Shared per normalised path and filter, loaded again once every reference is gone
+	std::shared_ptr<ITexture> loadTexture(const std::string& filePath, TextureFilter filter = TextureFilter::LINEAR)
+	{
+		return _textureCache.getTexture(filePath, filter, [this](const std::string& path, TextureFilter f) { return createTexture(path, f); });
+	}
+
+	std::shared_ptr<IArrayTexture> loadArrayTexture(int width, int height, const std::vector<std::string> &textures, TextureFilter filter = TextureFilter::LINEAR)
+	{
+		return _textureCache.getArrayTexture(width, height, textures, filter, [this](int w, int h, std::vector<std::string> &paths, TextureFilter f) { return createArrayTexture(w, h, paths, f); });
+	}
+
+	size_t purgeUnused(void) { return _textureCache.purgeUnused(); }
+
 	virtual void add(sprite &s) = 0;
 	virtual void add(IWidget *widget) = 0;
 	virtual void add(ILabel *label) = 0;
@@ -99,6 +122,12 @@ public:
 	virtual void remove(ILabel *label) = 0;
 	virtual void remove(std::shared_ptr<ILight> &light) = 0;
 
+	// Threading: textures, array textures and frame buffers may be created or
+	// released from any thread, the GL work runs on (or is deferred to) the
+	// thread owning the context. Lights do no GL work when created, they are
+	// constructed directly on any thread. Widgets, labels, sprites and cameras belong to
+	// the game thread, they are recorded by draw() / swap() and may be mutated
+	// as soon as swap() returns.
 	virtual void draw(void) = 0;
 	virtual void swap(void) = 0;
 
@@ -112,6 +141,19 @@ public:
 	virtual IMouse *getMouse(void) = 0;
 	virtual IGamepadManager *getGamepadManager(void) = 0;
 	virtual unsigned int getTime(void) const = 0;
+	virtual bool isRenderThreadEnabled(void) const = 0;
+	virtual bool isGPUProfilingEnabled(void) const = 0;
+	// Per pass GPU times, resolved GPU_PROFILER_LATENCY frames late
+	virtual std::vector<GPUPass> getGPUPasses(void) = 0;
+	// Counters of the last presented frame and of the frames before it
+	virtual RenderStats getStats(void) = 0;
+	virtual RenderStatsHistory getStatsHistory(void) = 0;
+	// RGBA8 copy of the last presented frame, top row first,
+	// getWindow()->getContextWidth() x getContextHeight() pixels
+	virtual void readFrame(std::vector<unsigned char> &pixels) = 0;
+	TextureCacheStats getTextureCacheStats(void) { return _textureCache.getStats(); }
+	// Allocated GPU memory per category, the budget and the evictions
+	virtual MemoryReport getMemoryReport(void) = 0;
 
 	// Setters
 	void setNavigationType(const NavigationType &type) { _currentNavigationType = type; }
@@ -120,12 +162,20 @@ public:
 	virtual void setMousePicker(MousePicker* picker) = 0;
 	virtual void setAxis(IAxis* axis) = 0;
 	virtual void setGridEnable(bool val) = 0;
+	virtual void setRenderThread(bool enabled) = 0;
+	virtual void setGPUProfiling(bool enabled) = 0;
+	// Bytes of asynchronously loaded textures uploaded per frame, at least one texture goes through
+	virtual void setTextureUploadBudget(size_t bytes) = 0;
+	// Over bytes allocated (0: unlimited), textures loaded from a file and unbound for
+	// idleFrames are evicted least recently used first, they load again on their next use
+	virtual void setMemoryBudget(uint64_t bytes, unsigned int idleFrames = MEMORY_IDLE_FRAMES) = 0;
 protected:
 	NavigationType _currentNavigationType;
 	float		_UIScaleFactor;
 	ICamera	 *_pCurrentCamera;
 	MousePicker *_pMousePicker;
 	IAxis		*_pAxis;
+	TextureCache _textureCache;
 };
 
 }
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <glm/vec4.hpp>
 #include "Enums.h"
 #include "IResource.h"
 
@@ -48,6 +50,19 @@ public:
 
 	virtual int getWidth(void) const = 0;
 	virtual int getHeight(void) const = 0;
+
+	// False while an asynchronous load is in flight, a placeholder is bound meanwhile
+	virtual bool isResident(void) const = 0;
+
+	// Part of getEngineId() covered, (x, y, width, height) in texture coordinates
+	virtual glm::vec4 getUVRect(void) const { return glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); }
+	// GPU memory it allocated, mip levels included. 0 for a part of another texture.
+	virtual uint64_t getAllocatedBytes(void) const { return 0; }
+
+	// Setters
+	// Mip level selection, effective with the TRILINEAR and ANISOTROPIC filters
+	virtual void setLodBias(float bias) = 0;
+	virtual void setLodRange(float minLod, float maxLod) = 0;
 };
 
 }
@@ -0,0 +1,60 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <memory>
+
+#include "ITexture.h"
+
+// Width and height of an atlas page by default
+#define TEXTURE_ATLAS_PAGE_SIZE		1024
+// Pixels around each image, filled with its edges so filtering never reads a neighbour
+#define TEXTURE_ATLAS_PADDING		2
+
+namespace	ExoRenderer
+{
+
+// Packs small images into a few large pages, so widgets drawn from the
+// same page can share their binds. A page is added when none has room left.
+class ITextureAtlas
+{
+public:
+	ITextureAtlas(void)
+	{ }
+
+	virtual ~ITextureAtlas(void)
+	{ }
+
+	// A region usable wherever an ITexture is, the atlas keeps its pages alive.
+	// Throws std::invalid_argument when the image is larger than a page.
+	virtual std::shared_ptr<ITexture>	add(const std::string& filePath) = 0;
+
+	// Getters
+	virtual size_t						getPageCount(void) const = 0;
+	virtual std::shared_ptr<ITexture>	getPage(size_t index) const = 0;
+};
+
+}
@@ -54,6 +54,7 @@ public:
 
 	virtual int getHighDPIFactor(void) const = 0;
 	virtual bool isFullscreen(void) const = 0;
+	virtual bool isHeadless(void) const = 0;
 
 	virtual bool getIsClosing(void) const = 0;
 
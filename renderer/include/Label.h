@@ -27,9 +27,11 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
+#include <vector>
 
 #include "ILabel.h"
 #include "Font.h"
+#include "TextLayout.h"
 #include "anchorPoint.h"
 #include "textAlignment.h"
 
@@ -39,6 +41,17 @@ namespace	ExoRenderer
 class Label : public ILabel
 {
 public:
+	// Glyph vertices laid out by the renderer, relative to the label position.
+	// Cleared when the text, font, scale or color change.
+	struct GlyphCache
+	{
+		std::vector<float>	vertices;	// Relative to the label, moving it keeps them
+		bool				valid;
+		float				scale;		// getFontScale of the layout
+		uint32_t			pages;		// Font::getPages of its glyphs
+		unsigned int		generation;	// Font::getGeneration of the layout
+	};
+
 	Label(void);
 	~Label(void);
 
@@ -46,10 +59,11 @@ public:
 	virtual void updateGlyph();
 
 	// Getters
-	virtual std::string getText(void) const;
+	virtual const std::string& getText(void) const;
 	virtual glm::vec3 getColor(void) const;
 	virtual glm::vec2 getGlyphLayout(void) const;
 	virtual const std::shared_ptr<Font>& getFont(void);
+	virtual const std::vector<TextLine>& getLines(void);
 	virtual float getFontScale(void) const;
 	virtual TextAlignment getTextAlignment(void) const;
 
@@ -67,6 +81,7 @@ public:
 	virtual float getScaleFactor(void) const;
 	virtual float getContextWidth(void) const;
 	virtual float getContextHeight(void) const;
+	GlyphCache	&getGlyphCache(void);
 
 	// Setters
 	virtual void setScale(bool scale);
@@ -94,7 +109,6 @@ public:
 	virtual void setColor(const glm::vec3& color);
 	virtual void setColor(float r, float g, float b);
 private:
-	glm::vec2 calcGlyphLayout(std::string& text, const float& scale, const std::shared_ptr<Font>& font);
 	glm::vec2 calcRealPosition(const glm::vec2& position, const glm::vec2& margin, const glm::vec2& size, const AnchorPoint& anchor, const AnchorPoint& localAnchor);
 private:
 	std::string _text;
@@ -103,6 +117,8 @@ private:
 	std::shared_ptr<Font> _font;
 	float _fontScale;
 	float _maxWidth;
+	TextLayout _layout;
+	size_t _layoutFrom;	// First byte changed since the last layout, npos for none
 
 	// Default
 	AnchorPoint _anchor;
@@ -125,6 +141,8 @@ private:
 	glm::vec2 _scalePosition;
 	glm::vec2 _scaleVirtualOffset;
 	glm::vec2 _scaleRelativeParentPosition;
+
+	GlyphCache _glyphCache;
 };
 
 }
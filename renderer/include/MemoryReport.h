@@ -0,0 +1,70 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Enums.h"
+
+// Frames a texture stays unbound before it may be evicted, by default
+#define MEMORY_IDLE_FRAMES	300
+
+namespace	ExoRenderer
+{
+
+// GPU memory allocated by the renderer, estimated from the storage it requested
+struct MemoryReport
+{
+	uint64_t	bytes[MEMORY_CATEGORY_MAX];
+	uint64_t	budget;				// 0 when unlimited
+	uint32_t	evictable;			// Textures loaded from a file, resident
+	uint32_t	evicted;			// Textures waiting for their next use to load again
+	uint64_t	evictions;			// Since startup
+	uint64_t	reloads;
+	uint64_t	overBudgetFrames;	// Still over budget once every idle texture was evicted
+
+	MemoryReport(void)
+	: budget(0), evictable(0), evicted(0), evictions(0), reloads(0), overBudgetFrames(0)
+	{
+		for (uint64_t &category : bytes)
+			category = 0;
+	}
+
+	uint64_t	getTotal(void) const
+	{
+		uint64_t total = 0;
+
+		for (uint64_t category : bytes)
+			total += category;
+		return total;
+	}
+
+	bool		isOverBudget(void) const
+	{
+		return budget > 0 && getTotal() > budget;
+	}
+};
+
+}
@@ -0,0 +1,115 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Events kept per thread, the oldest are overwritten
+#define PROFILER_BUFFER_SIZE	16384
+
+// Define EXO_DISABLE_PROFILER to compile the zones out entirely
+#ifndef EXO_DISABLE_PROFILER
+# define EXO_PROFILE_CONCAT_(a, b)	a##b
+# define EXO_PROFILE_CONCAT(a, b)	EXO_PROFILE_CONCAT_(a, b)
+# define EXO_PROFILE_ZONE(name)		ExoRenderer::ProfilerZone EXO_PROFILE_CONCAT(profilerZone, __LINE__)(name)
+#else
+# define EXO_PROFILE_ZONE(name)
+#endif
+
+namespace	ExoRenderer
+{
+
+struct ProfilerEvent
+{
+	const char		*name;	// Static string, never copied
+	uint64_t		begin;	// Nanoseconds
+	uint64_t		end;
+};
+
+class Profiler
+{
+public:
+	static Profiler	&Get(void);
+
+	static bool		isEnabled(void) { return _enabled.load(std::memory_order_relaxed); }
+	static uint64_t	now(void);
+
+	void	record(const char *name, uint64_t begin, uint64_t end);
+	void	setThreadName(const char *name);
+
+	// Write the events of the last milliseconds (all buffered ones with 0)
+	// as Chrome trace-event JSON, readable by chrome://tracing or Perfetto
+	bool	dumpChromeTrace(const std::string &filePath, unsigned int milliseconds = 0);
+	void	clear(void);
+
+	// Setters
+	void	setEnabled(bool enabled);
+private:
+	struct ThreadBuffer
+	{
+		std::mutex					mutex;
+		unsigned int				id;
+		std::string					name;
+		std::vector<ProfilerEvent>	events;
+		size_t						next;
+		bool						full;
+	};
+
+	Profiler(void);
+	~Profiler(void);
+
+	ThreadBuffer	*getThreadBuffer(void);
+private:
+	static std::atomic<bool>				_enabled;
+	static thread_local ThreadBuffer	*_pThreadBuffer;
+
+	std::mutex									_mutex;
+	std::vector<std::unique_ptr<ThreadBuffer>>	_buffers;
+};
+
+// Scoped zone, a relaxed load and a branch when the profiler is disabled
+class ProfilerZone
+{
+public:
+	ProfilerZone(const char *name)
+	: _name(Profiler::isEnabled() ? name : nullptr), _begin(_name ? Profiler::now() : 0)
+	{	}
+
+	~ProfilerZone(void)
+	{
+		if (_name)
+			Profiler::Get().record(_name, _begin, Profiler::now());
+	}
+private:
+	const char	*_name;
+	uint64_t	_begin;
+};
+
+}
@@ -0,0 +1,62 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace	ExoRenderer
+{
+
+// Skyline bottom-left packing of rectangles into a fixed area: each
+// rectangle goes where its top edge ends up the lowest
+class RectPacker
+{
+public:
+	RectPacker(int width, int height);
+	~RectPacker(void);
+
+	// false when the rectangle doesn't fit anymore
+	bool	insert(int width, int height, int &x, int &y);
+	void	clear(void);
+
+	// Getters
+	int		getWidth(void) const;
+	int		getHeight(void) const;
+	float	getOccupancy(void) const;	// Packed area over the total area
+private:
+	struct Segment
+	{
+		int	x, y, width;
+	};
+
+	bool	fit(size_t index, int width, int height, int &y) const;
+private:
+	std::vector<Segment>	_skyline;
+	int						_width, _height;
+	size_t					_usedArea;
+};
+
+}
@@ -0,0 +1,123 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Frames kept by RenderStatsHistory by default
+#define RENDER_STATS_HISTORY	300
+
+namespace	ExoRenderer
+{
+
+// Counters of one frame
+struct RenderStats
+{
+	uint32_t	drawCalls;
+	uint32_t	instances;
+	uint32_t	triangles;
+	uint32_t	textureBinds;
+	uint32_t	programBinds;
+	uint32_t	uniformUploads;
+	uint64_t	bufferBytes;	// Uploaded to buffers
+	uint64_t	textureBytes;	// Uploaded to textures
+	uint32_t	scissorChanges;
+	uint32_t	spritesDrawn;
+	uint32_t	spritesCulled;
+	uint32_t	widgets;
+	uint32_t	glyphs;
+	double		frameTime;		// Milliseconds, from IWindow::getDelta
+
+	RenderStats(void)
+	{
+		reset();
+	}
+
+	void reset(void)
+	{
+		drawCalls = 0;
+		instances = 0;
+		triangles = 0;
+		textureBinds = 0;
+		programBinds = 0;
+		uniformUploads = 0;
+		bufferBytes = 0;
+		textureBytes = 0;
+		scissorChanges = 0;
+		spritesDrawn = 0;
+		spritesCulled = 0;
+		widgets = 0;
+		glyphs = 0;
+		frameTime = 0.0;
+	}
+};
+
+// Ring of the last frames
+class RenderStatsHistory
+{
+public:
+	RenderStatsHistory(size_t capacity = RENDER_STATS_HISTORY);
+	~RenderStatsHistory(void);
+
+	void	push(const RenderStats &stats);
+	void	clear(void);
+
+	// Getters
+	size_t				getSize(void) const;
+	size_t				getCapacity(void) const;
+	const RenderStats	&get(size_t index) const;	// 0 is the oldest
+	const RenderStats	&getLast(void) const;	// All zero while empty
+
+	// Nearest-rank percentile (0 - 100) of a counter over the kept frames,
+	// e.g. getPercentile(95, &RenderStats::frameTime)
+	template <typename T>
+	double	getPercentile(double percentile, T RenderStats::*member) const
+	{
+		std::vector<double>	values;
+
+		if (_stats.empty())
+			return 0.0;
+
+		values.reserve(_stats.size());
+		for (const RenderStats &stats : _stats)
+			values.push_back((double)(stats.*member));
+
+		size_t rank = (size_t)std::ceil(percentile * values.size() / 100.0);
+		rank = std::min(std::max(rank, (size_t)1), values.size()) - 1;
+		std::nth_element(values.begin(), values.begin() + rank, values.end());
+		return values[rank];
+	}
+
+	double	getFrameTimePercentile(double percentile) const;
+private:
+	std::vector<RenderStats>	_stats;
+	size_t						_capacity;
+	size_t						_next;
+};
+
+}
@@ -0,0 +1,79 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/vec2.hpp>
+
+// Advance of a space and distance between two lines, before the font scale
+#define TEXT_SPACE_ADVANCE	18
+#define TEXT_LINE_HEIGHT	85
+
+namespace	ExoRenderer
+{
+
+class Font;
+
+// A line of laid out text, as byte offsets in the text. The break, a '\n'
+// or the space the line was wrapped at, isn't part of it.
+struct TextLine
+{
+	size_t	begin, end;
+	float	width;		// Scaled
+	float	bottom;		// Of its lowest glyph, scaled
+};
+
+// Greedy word wrapping at spaces, a word longer than the maximum width overflows.
+// The text is never modified, its breaks are kept on the side. After an edit only the
+// lines from the one before the edit on are laid out again: wrapping a line depends
+// on the first word of the next one, not on anything further.
+class TextLayout
+{
+public:
+	TextLayout(void);
+	~TextLayout(void);
+
+	// first: first byte that changed since the last call. Everything is laid out
+	// again when the scale, the maximum width (0: none) or the glyphs of the font changed.
+	void	update(const std::string& text, size_t first, float scale, float maxWidth, const Font& font);
+	void	clear(void);
+
+	// Getters
+	const std::vector<TextLine>	&getLines(void) const;
+	size_t						getLine(size_t index) const;	// Holding the byte at index
+	glm::vec2					getSize(void) const;			// Widest line, bottom of the last one
+	float						getLineHeight(void) const;		// Scaled
+private:
+	std::vector<TextLine>	_lines;
+	glm::vec2				_size;
+	float					_scale;
+	float					_maxWidth;
+	const Font				*_pFont;		// Only compared
+	unsigned int			_generation;
+};
+
+}
@@ -0,0 +1,79 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+#include "ITexture.h"
+#include "IArrayTexture.h"
+
+namespace	ExoRenderer
+{
+
+struct TextureCacheStats
+{
+	uint64_t	hits;
+	uint64_t	misses;
+	size_t		textures;		// Alive, array textures included
+	uint64_t	residentBytes;	// Allocated by the alive textures, see ITexture::getAllocatedBytes
+};
+
+// Textures shared per normalised path and filter. Only weak references are
+// kept, a texture is freed with its last shared_ptr and loaded again afterwards.
+class TextureCache
+{
+public:
+	typedef std::function<ITexture *(const std::string &, TextureFilter)>								TextureFactory;
+	typedef std::function<IArrayTexture *(int, int, std::vector<std::string> &, TextureFilter)>		ArrayTextureFactory;
+
+	TextureCache(void);
+	~TextureCache(void);
+
+	std::shared_ptr<ITexture>		getTexture(const std::string &filePath, TextureFilter filter, const TextureFactory &factory);
+	std::shared_ptr<IArrayTexture>	getArrayTexture(int width, int height, const std::vector<std::string> &textures, TextureFilter filter, const ArrayTextureFactory &factory);
+
+	// Forgets the entries of freed textures, returns how many
+	size_t				purgeUnused(void);
+
+	// Getters
+	TextureCacheStats	getStats(void);
+
+	// "a/./b//../c.png" and "a\c.png" both give "a/c.png"
+	static std::string	normalizePath(const std::string &path);
+private:
+	std::mutex														_mutex;
+	std::unordered_map<std::string, std::weak_ptr<ITexture>>		_textures;
+	std::unordered_map<std::string, std::weak_ptr<IArrayTexture>>	_arrayTextures;
+	uint64_t														_hits;
+	uint64_t														_misses;
+};
+
+}
@@ -0,0 +1,60 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+
+namespace	ExoRenderer
+{
+
+// Fixed set of worker threads running jobs in submission order.
+// Jobs still queued when the pool is destroyed are dropped, the running ones are waited for.
+class ThreadPool
+{
+public:
+	ThreadPool(unsigned int workers = 0);	// 0: one per core but one, at least one
+	~ThreadPool(void);
+
+	void	post(const std::function<void(void)> &job);
+
+	// Getters
+	unsigned int	getWorkerCount(void) const;
+	size_t			getQueuedCount(void);
+private:
+	void	run(void);
+private:
+	std::vector<std::thread>				_workers;
+	std::mutex								_mutex;
+	std::condition_variable					_condition;
+	std::deque<std::function<void(void)>>	_jobs;
+	bool									_running;
+};
+
+}
@@ -0,0 +1,113 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define UTF8_ITERATOR_SSE2
+#endif
+
+namespace	ExoRenderer
+{
+
+// Code points of UTF-8 bytes, decoded in place without allocating. A malformed sequence
+// gives U+FFFD. Runs of ASCII are skipped 16 bytes at a time where SSE2 is available,
+// their bytes are then returned as they are.
+class Utf8Iterator
+{
+public:
+	Utf8Iterator(const char *begin, const char *end)
+	: _current(begin), _end(end), _ascii(begin)
+	{ }
+
+	Utf8Iterator(const std::string& text, size_t begin = 0, size_t end = std::string::npos)
+	: _current(text.data() + begin), _end(text.data() + (end < text.length() ? end : text.length())), _ascii(_current)
+	{ }
+
+	inline bool hasNext(void) const
+	{
+		return _current < _end;
+	}
+
+	inline uint32_t next(void)
+	{
+		if (_current >= _ascii)
+			scan();
+		if (_current < _ascii)
+			return (unsigned char)*_current++;
+		return decode();
+	}
+
+	// Getters
+	const char *getPosition(void) const { return _current; }
+
+	// Setters
+	void setPosition(const char *position) { _current = position; _ascii = position; }
+private:
+	// Moves _ascii to the first byte from _current that isn't ASCII
+	inline void scan(void)
+	{
+		const char *position = _current;
+
+#ifdef UTF8_ITERATOR_SSE2
+		while (_end - position >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)position)))
+			position += 16;
+#endif
+		while (position < _end && !((unsigned char)*position & 0x80))
+			position++;
+		_ascii = position;
+	}
+
+	inline uint32_t decode(void)
+	{
+		unsigned char	lead = (unsigned char)*_current++;
+		unsigned int	length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 4;
+		uint32_t		codePoint = lead & (0x3F >> length);
+
+		if (length > 3 || lead > 0xF4)
+			return 0xFFFD;
+		for (unsigned int i = 0; i < length; i++)
+		{
+			if (_current >= _end || ((unsigned char)*_current & 0xC0) != 0x80)
+				return 0xFFFD;
+			codePoint = (codePoint << 6) | ((unsigned char)*_current++ & 0x3F);
+		}
+
+		// Overlong, a UTF-16 surrogate, or past U+10FFFF
+		if (codePoint < (length == 1 ? 0x80u : length == 2 ? 0x800u : 0x10000u)
+			|| (codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+			return 0xFFFD;
+		return codePoint;
+	}
+private:
+	const char	*_current;
+	const char	*_end;
+	const char	*_ascii;	// End of the ASCII run _current is in
+};
+
+}
@@ -51,7 +51,7 @@ struct sprite
 
 	// Constructor
 	sprite()
-	: position(glm::vec2(0.0f)), scale(glm::vec2(1.0f)), angle(0.0f), layer(0), texture(nullptr), normalMapTexture(nullptr)
+	: position(glm::vec2(0.0f)), scale(glm::vec2(1.0f)), angle(0.0f), layer(0), flip(DEFAULT), texture(nullptr), normalMapTexture(nullptr)
 	{
 	}
 
@@ -70,6 +70,14 @@ struct sprite
 		normalMapTexture = b.normalMapTexture;
 		return (*this);
 	}
+
+	// Queues keep copies, so sprites are matched by value on removal
+	bool	operator==(const sprite &b) const
+	{
+		return (position == b.position && scale == b.scale && angle == b.angle
+			&& layer == b.layer && flip == b.flip
+			&& texture == b.texture && normalMapTexture == b.normalMapTexture);
+	}
 };
 
 }
@@ -0,0 +1,89 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "AtlasRegion.h"
+
+using namespace ExoRenderer;
+
+AtlasRegion::AtlasRegion(const std::shared_ptr<ITexture> &page, int x, int y, int width, int height)
+: _pPage(page), _x(x), _y(y), _width(width), _height(height)
+{ }
+
+AtlasRegion::~AtlasRegion(void)
+{ }
+
+void AtlasRegion::bind(int unit) const
+{
+	_pPage->bind(unit);
+}
+
+void AtlasRegion::unbind(void) const
+{
+	_pPage->unbind();
+}
+
+// Getters
+int AtlasRegion::getEngineId(void) const
+{
+	return _pPage->getEngineId();
+}
+
+int AtlasRegion::getWidth(void) const
+{
+	return _width;
+}
+
+int AtlasRegion::getHeight(void) const
+{
+	return _height;
+}
+
+bool AtlasRegion::isResident(void) const
+{
+	return _pPage->isResident();
+}
+
+glm::vec4 AtlasRegion::getUVRect(void) const
+{
+	float pageWidth = (float)_pPage->getWidth();
+	float pageHeight = (float)_pPage->getHeight();
+
+	return glm::vec4(_x / pageWidth, _y / pageHeight, _width / pageWidth, _height / pageHeight);
+}
+
+const std::shared_ptr<ITexture> &AtlasRegion::getPage(void) const
+{
+	return _pPage;
+}
+
+// Setters
+void AtlasRegion::setLodBias(float bias)
+{
+	_pPage->setLodBias(bias);
+}
+
+void AtlasRegion::setLodRange(float minLod, float maxLod)
+{
+	_pPage->setLodRange(minLod, maxLod);
+}
@@ -0,0 +1,366 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "FntLoader.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// Binary descriptors start with "BMF" then this version
+#define FNT_BINARY_VERSION		3
+// Blocks of a binary descriptor
+#define FNT_BLOCK_COMMON		2
+#define FNT_BLOCK_CHARS			4
+#define FNT_BLOCK_KERNING		5
+// Records of the chars and kerning blocks
+#define FNT_BINARY_CHAR_SIZE	20
+#define FNT_BINARY_KERNING_SIZE	10
+
+using namespace ExoRenderer;
+
+// key=value of a text descriptor line, pointing into the file
+struct FntField
+{
+	const char	*key, *keyEnd;
+	const char	*value, *valueEnd;
+
+	bool	is(const char* name) const
+	{
+		size_t length = std::strlen(name);
+
+		return (size_t)(keyEnd - key) == length && std::memcmp(key, name, length) == 0;
+	}
+};
+
+static bool isBlank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Next field of the line, false at its end
+static bool nextField(const char*& cursor, const char* end, FntField& field)
+{
+	while (cursor < end && isBlank(*cursor))
+		cursor++;
+	if (cursor >= end)
+		return false;
+
+	field.key = cursor;
+	while (cursor < end && !isBlank(*cursor) && *cursor != '=')
+		cursor++;
+	field.keyEnd = cursor;
+	field.value = cursor;
+	field.valueEnd = cursor;
+	if (cursor >= end || *cursor != '=')
+		return true;
+
+	// Quoted values may hold spaces
+	cursor++;
+	if (cursor < end && *cursor == '"')
+	{
+		field.value = ++cursor;
+		while (cursor < end && *cursor != '"')
+			cursor++;
+		field.valueEnd = cursor;
+		if (cursor < end)
+			cursor++;
+	}
+	else
+	{
+		field.value = cursor;
+		while (cursor < end && !isBlank(*cursor))
+			cursor++;
+		field.valueEnd = cursor;
+	}
+	return true;
+}
+
+// Every BMFont number is an integer, lists like padding=1,1,1,1 give their first one
+static int parseInt(const FntField& field)
+{
+	const char	*cursor = field.value;
+	bool		negative = cursor < field.valueEnd && *cursor == '-';
+	int			value = 0;
+
+	if (negative)
+		cursor++;
+	while (cursor < field.valueEnd && *cursor >= '0' && *cursor <= '9')
+		value = value * 10 + (*cursor++ - '0');
+	return negative ? -value : value;
+}
+
+static uint16_t read16(const unsigned char* data)
+{
+	return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t read32(const unsigned char* data)
+{
+	return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+FntLoader::FntLoader(const std::string& path)
+: _lineHeight(0), _base(0), _width(0), _height(0), _type(FONT_BITMAP), _distanceRange(0), _glyphCount(0)
+{
+	GlyphList	glyphs;
+
+	// A missing descriptor gives a font without glyphs
+	try
+	{
+		MappedFile	file(path);
+
+		if (file.getSize() >= 4 && std::memcmp(file.getData(), "BMF", 3) == 0)
+			parseBinary(file.getData(), file.getSize(), glyphs);
+		else
+			parseText((const char*)file.getData(), file.getSize(), glyphs);
+	}
+	catch (const std::runtime_error&)
+	{
+		glyphs.clear();
+	}
+	buildPages(glyphs);
+}
+
+FntLoader::~FntLoader(void)
+{ }
+
+// Getters
+size_t FntLoader::getGlyphCount(void) const
+{
+	return _glyphCount;
+}
+
+size_t FntLoader::getKerningCount(void) const
+{
+	return _kerning.size();
+}
+
+FontType FntLoader::getType(void) const
+{
+	return _type;
+}
+
+float FntLoader::getDistanceRange(void) const
+{
+	return _distanceRange;
+}
+
+// Private
+void FntLoader::parseText(const char* data, size_t size, GlyphList& glyphs)
+{
+	const char	*end = data + size;
+	FntField	field;
+
+	for (const char *line = data; line < end;)
+	{
+		const char	*lineEnd = (const char*)std::memchr(line, '\n', end - line);
+		const char	*cursor = line;
+
+		if (!lineEnd)
+			lineEnd = end;
+		line = lineEnd + 1;
+		if (!nextField(cursor, lineEnd, field))
+			continue ;
+
+		if (field.is("common"))
+		{
+			while (nextField(cursor, lineEnd, field))
+			{
+				if (field.is("lineHeight"))
+					_lineHeight = (unsigned short)parseInt(field);
+				else if (field.is("base"))
+					_base = (unsigned short)parseInt(field);
+				else if (field.is("scaleW"))
+					_width = (float)parseInt(field);
+				else if (field.is("scaleH"))
+					_height = (float)parseInt(field);
+			}
+		}
+		else if (field.is("distanceField"))
+		{
+			// Written by msdf-bmfont: distanceField fieldType=msdf distanceRange=4
+			while (nextField(cursor, lineEnd, field))
+			{
+				if (field.is("fieldType"))
+					_type = (field.value < field.valueEnd && *field.value == 'm') ? FONT_MSDF : FONT_SDF;	// msdf, mtsdf or sdf, psdf
+				else if (field.is("distanceRange"))
+					_distanceRange = (float)parseInt(field);
+			}
+		}
+		else if (field.is("chars"))
+		{
+			while (nextField(cursor, lineEnd, field))
+				if (field.is("count"))
+					glyphs.reserve(std::max(parseInt(field), 0));
+		}
+		else if (field.is("char"))
+		{
+			CharDescriptor character;
+			uint32_t charId = 0;
+
+			while (nextField(cursor, lineEnd, field))
+			{
+				if (field.is("id"))
+					charId = (uint32_t)parseInt(field);
+				else if (field.is("x"))
+					character.x = (float)parseInt(field);
+				else if (field.is("y"))
+					character.y = (float)parseInt(field);
+				else if (field.is("width"))
+					character.width = (unsigned short)parseInt(field);
+				else if (field.is("height"))
+					character.height = (unsigned short)parseInt(field);
+				else if (field.is("xoffset"))
+					character.xOffset = (float)parseInt(field);
+				else if (field.is("yoffset"))
+					character.yOffset = (float)parseInt(field);
+				else if (field.is("xadvance"))
+					character.xAdvance = (float)parseInt(field);
+			}
+			addGlyph(glyphs, charId, character);
+		}
+		else if (field.is("kernings"))
+		{
+			while (nextField(cursor, lineEnd, field))
+				if (field.is("count"))
+					_kerning.reserve(std::max(parseInt(field), 0));
+		}
+		else if (field.is("kerning"))
+		{
+			uint32_t first = 0, second = 0;
+			int amount = 0;
+
+			while (nextField(cursor, lineEnd, field))
+			{
+				if (field.is("first"))
+					first = (uint32_t)parseInt(field);
+				else if (field.is("second"))
+					second = (uint32_t)parseInt(field);
+				else if (field.is("amount"))
+					amount = parseInt(field);
+			}
+
+			if (amount != 0)
+				_kerning[((uint64_t)first << 32) | second] = (float)amount;
+		}
+	}
+}
+
+void FntLoader::parseBinary(const unsigned char* data, size_t size, GlyphList& glyphs)
+{
+	size_t	offset = 4;
+
+	if (data[3] != FNT_BINARY_VERSION)
+		throw (std::runtime_error("unsupported BMFont binary version " + std::to_string(data[3])));
+
+	// Blocks of a type byte and a 32 bits size
+	while (offset + 5 <= size)
+	{
+		unsigned char			type = data[offset];
+		size_t					blockSize = read32(data + offset + 1);
+		const unsigned char		*block = data + offset + 5;
+
+		offset += 5;
+		if (blockSize > size - offset)
+			throw (std::runtime_error("truncated BMFont binary descriptor"));
+		offset += blockSize;
+
+		switch (type)
+		{
+			case FNT_BLOCK_COMMON:
+				if (blockSize < 8)
+					break;
+				_lineHeight = read16(block);
+				_base = read16(block + 2);
+				_width = read16(block + 4);
+				_height = read16(block + 6);
+				break;
+			case FNT_BLOCK_CHARS:
+				glyphs.reserve(glyphs.size() + blockSize / FNT_BINARY_CHAR_SIZE);
+				for (size_t i = 0; i + FNT_BINARY_CHAR_SIZE <= blockSize; i += FNT_BINARY_CHAR_SIZE)
+				{
+					CharDescriptor		character;
+					const unsigned char	*record = block + i;
+
+					character.x = read16(record + 4);
+					character.y = read16(record + 6);
+					character.width = read16(record + 8);
+					character.height = read16(record + 10);
+					character.xOffset = (int16_t)read16(record + 12);
+					character.yOffset = (int16_t)read16(record + 14);
+					character.xAdvance = (int16_t)read16(record + 16);
+					addGlyph(glyphs, read32(record), character);
+				}
+				break;
+			case FNT_BLOCK_KERNING:
+				_kerning.reserve(_kerning.size() + blockSize / FNT_BINARY_KERNING_SIZE);
+				for (size_t i = 0; i + FNT_BINARY_KERNING_SIZE <= blockSize; i += FNT_BINARY_KERNING_SIZE)
+				{
+					const unsigned char	*record = block + i;
+					int16_t				amount = (int16_t)read16(record + 8);
+
+					if (amount != 0)
+						_kerning[((uint64_t)read32(record) << 32) | read32(record + 4)] = amount;
+				}
+				break;
+			default: // Info and pages
+				break;
+		}
+	}
+}
+
+void FntLoader::addGlyph(GlyphList& glyphs, uint32_t id, CharDescriptor& character) const
+{
+	character.xMaxTextureCoord = (character.width + character.x) / _width;
+	character.yMaxTextureCoord = (character.height + character.y) / _height;
+	character.x /= _width;
+	character.y /= _height;
+	glyphs.emplace_back(id, character);
+}
+
+void FntLoader::buildPages(const GlyphList& glyphs)
+{
+	unsigned int	counts[FNT_DIRECT_PAGES] = {0};
+
+	for (const auto& glyph : glyphs)
+		if (glyph.first < FNT_DIRECT_PAGES * FNT_PAGE_SIZE)
+			counts[glyph.first / FNT_PAGE_SIZE]++;
+
+	// Latin-1 is always dense, the other pages once the font covers enough of them
+	for (unsigned int page = 0; page < FNT_DIRECT_PAGES; page++)
+		if (page == 0 || counts[page] >= FNT_DENSE_GLYPHS)
+			_pages[page].reset(new CharDescriptor[FNT_PAGE_SIZE]);
+
+	// The last definition of a glyph wins
+	for (const auto& glyph : glyphs)
+	{
+		if (glyph.first < FNT_DIRECT_PAGES * FNT_PAGE_SIZE && _pages[glyph.first / FNT_PAGE_SIZE])
+			_pages[glyph.first / FNT_PAGE_SIZE][glyph.first % FNT_PAGE_SIZE] = glyph.second;
+		else
+			_sparse[glyph.first] = glyph.second;
+	}
+	_glyphCount = glyphs.size();
+}
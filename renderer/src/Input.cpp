@@ -350,7 +350,7 @@ void Input::overflow()
 		{
 			while (_pLabel->getGlyphLayout().x > (_scaleSize.x * 2.0f) - 10)
 			{
-				_pLabel->setText(_pLabel->getText().erase(0, 1));
+				_pLabel->setText(_pLabel->getText().substr(1));
 				_pLabel->updateGlyph();
 			}
 		}
@@ -358,7 +358,7 @@ void Input::overflow()
 		{
 			while (_pLabel->getGlyphLayout().x > (_scaleSize.x * 2.0f) - 10)
 			{
-				_pLabel->setText(_pLabel->getText().erase(_pLabel->getText().length()-1, 1));
+				_pLabel->setText(_pLabel->getText().substr(0, _pLabel->getText().length()-1));
 				_pLabel->updateGlyph();
 			}
 		}
@@ -24,14 +24,21 @@
 
 #include "Label.h"
 
+#include <algorithm>
+
 using namespace ExoRenderer;
 
 Label::Label(void)
-: ILabel(), _text(""), _color(glm::vec3(1, 1, 1)), _glyphLayout(0.0f), _font(nullptr), _fontScale(1.0f), _maxWidth(0), _anchor(AnchorPoint::TOP_LEFT),
+: ILabel(), _text(""), _color(glm::vec3(1, 1, 1)), _glyphLayout(0.0f), _font(nullptr), _fontScale(1.0f), _maxWidth(0), _layoutFrom(0), _anchor(AnchorPoint::TOP_LEFT),
 _localAnchor(AnchorPoint::CENTER), _textAlignment(TextAlignment::CENTER), _position(glm::vec2(0.0f, 0.0f)), _margin(0.0f, 0.0f),
 _virtualOffset(glm::vec2(0.0f, 0.0f)), _relativeParentPosition(glm::vec2(0.0f, 0.0f)), _scaleFactor(1.0f), _contextWidth(1), _contextHeight(1),
 _scale(true), _realPosition(0.0f), _scalePosition(glm::vec2(0.0f, 0.0f)), _scaleVirtualOffset(glm::vec2(0.0f, 0.0f)), _scaleRelativeParentPosition(0.0f, 0.0f)
-{	}
+{
+	_glyphCache.valid = false;
+	_glyphCache.scale = 0.0f;
+	_glyphCache.pages = 0;
+	_glyphCache.generation = 0;
+}
 
 Label::~Label(void)
 {	}
@@ -58,7 +65,18 @@ void Label::contextInfo(float scaleFactor, float contextWidth, float contextHeig
 
 void Label::updateGlyph()
 {
-	_glyphLayout = calcGlyphLayout(_text, getFontScale(), _font);
+	// Positioned again by its parent every frame, the vertices only change with the layout
+	if (_layoutFrom != std::string::npos || _glyphCache.scale != getFontScale())
+	{
+		_glyphCache.valid = false;
+		_glyphCache.scale = getFontScale();
+	}
+
+	// Only the lines from the edit on are laid out again
+	if (_font)
+		_layout.update(_text, _layoutFrom, getFontScale(), _maxWidth * _scaleFactor, *_font);
+	_layoutFrom = std::string::npos;
+	_glyphLayout = _layout.getSize();
 	if (_scale)
 		_realPosition = calcRealPosition(_scalePosition, _margin * _scaleFactor, _glyphLayout, _anchor, _localAnchor);
 	else
@@ -66,7 +84,7 @@ void Label::updateGlyph()
 }
 
 // Getters
-std::string Label::getText(void) const
+const std::string& Label::getText(void) const
 {
 	return _text;
 }
@@ -141,6 +159,14 @@ const std::shared_ptr<Font>& Label::getFont(void)
 	return _font;
 }
 
+const std::vector<TextLine>& Label::getLines(void)
+{
+	// Laid out again first when the text changed since
+	if (_layoutFrom != std::string::npos)
+		updateGlyph();
+	return _layout.getLines();
+}
+
 float Label::getScaleFactor(void) const
 {
 	return _scaleFactor;
@@ -156,6 +182,11 @@ float Label::getContextHeight(void) const
 	return _contextHeight;
 }
 
+Label::GlyphCache &Label::getGlyphCache(void)
+{
+	return _glyphCache;
+}
+
 // Setters
 void Label::setScale(bool scale)
 {
@@ -164,7 +195,14 @@ void Label::setScale(bool scale)
 
 void Label::setText(const std::string& text)
 {
+	size_t first = std::mismatch(_text.begin(), _text.end(), text.begin(), text.end()).first - _text.begin();
+
+	if (first == _text.length() && first == text.length())
+		return ;
+
 	_text = text;
+	_glyphCache.valid = false;
+	_layoutFrom = std::min(_layoutFrom, first);
 }
 
 void Label::setAnchor(const AnchorPoint& anchor)
@@ -185,6 +223,7 @@ void Label::setTextAlignment(const TextAlignment& alignment)
 void Label::setMaxWidth(float maxWidth)
 {
 	_maxWidth = maxWidth;
+	_layoutFrom = 0;
 }
 
 void Label::setPosition(float x, float y)
@@ -235,60 +274,24 @@ void Label::setColor(const glm::vec3& color)
 void Label::setColor(float r, float g, float b)
 {
 	_color = glm::vec3(r, g, b);
+	_glyphCache.valid = false;
 }
 
 void Label::setFont(const std::shared_ptr<Font>& font)
 {
 	_font = font;
+	_glyphCache.valid = false;
+	_layoutFrom = 0;
 }
 
 void Label::setFontScale(float scale)
 {
 	_fontScale = scale;
+	_glyphCache.valid = false;
+	_layoutFrom = 0;
 }
 
 // Private
-glm::vec2 Label::calcGlyphLayout(std::string& text, const float& scale, const std::shared_ptr<Font>& font)
-{
-	float width = 0, maxWidth = 0;
-	float height = 0;
-	unsigned int lastWord = 0;
-
-	for (unsigned int i = 0; i < text.length(); i++)
-	{
-		if(text[i] == ' ') // Space
-		{
-			lastWord = i;
-			width += 18 * scale;
-		}
-		else if (text[i] == '\n') // Return
-		{
-			maxWidth = width;
-			width = 0;
-			height += 85 * scale;
-		}
-		else
-		{
-			CharDescriptor ch = font->getFont()->getCharacter(text[i]);
-			width += ch.xAdvance * scale;
-
-			if ((ch.height + ch.yOffset) * scale > height)
-				height = (ch.height + ch.yOffset) * scale;
-
-			if (_maxWidth > 0 && width > _maxWidth * _scaleFactor)
-			{
-				text[lastWord] = '\n';
-				i = lastWord - 1;
-			}
-		}
-
-		if (width > maxWidth)
-			maxWidth = width;
-	}
-
-	return glm::vec2(maxWidth, height);
-}
-
 glm::vec2 Label::calcRealPosition(const glm::vec2& position, const glm::vec2& margin, const glm::vec2& size, const AnchorPoint& anchor, const AnchorPoint& localAnchor)
 {
 	// Anchor (screen landmark)
@@ -0,0 +1,132 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "MappedFile.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace ExoRenderer;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string &filePath)
+: _pData(nullptr), _size(0), _file(INVALID_HANDLE_VALUE), _mapping(nullptr)
+{
+	LARGE_INTEGER	size;
+
+	_file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (_file == INVALID_HANDLE_VALUE)
+		throw (std::runtime_error("cannot open " + filePath));
+	if (!GetFileSizeEx(_file, &size))
+	{
+		CloseHandle(_file);
+		throw (std::runtime_error("cannot read the size of " + filePath));
+	}
+	_size = (size_t)size.QuadPart;
+
+	// Empty files can't be mapped
+	if (_size == 0)
+		return ;
+	_mapping = CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (_mapping)
+		_pData = (const unsigned char*)MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!_pData)
+	{
+		if (_mapping)
+			CloseHandle(_mapping);
+		CloseHandle(_file);
+		throw (std::runtime_error("cannot map " + filePath));
+	}
+}
+
+MappedFile::~MappedFile(void)
+{
+	if (_pData)
+		UnmapViewOfFile(_pData);
+	if (_mapping)
+		CloseHandle(_mapping);
+	CloseHandle(_file);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &filePath)
+: _pData(nullptr), _size(0)
+{
+	struct stat	status;
+	int			file = open(filePath.c_str(), O_RDONLY);
+	void		*data;
+
+	if (file < 0)
+		throw (std::runtime_error("cannot open " + filePath));
+	if (fstat(file, &status) != 0)
+	{
+		close(file);
+		throw (std::runtime_error("cannot read the size of " + filePath));
+	}
+	_size = (size_t)status.st_size;
+
+	// Empty files can't be mapped, the mapping outlives the descriptor
+	if (_size > 0)
+	{
+		data = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (data == MAP_FAILED)
+		{
+			close(file);
+			throw (std::runtime_error("cannot map " + filePath));
+		}
+		_pData = (const unsigned char*)data;
+		// Read whole, start reading ahead
+		madvise(data, _size, MADV_WILLNEED);
+	}
+	close(file);
+}
+
+MappedFile::~MappedFile(void)
+{
+	if (_pData)
+		munmap((void*)_pData, _size);
+}
+
+#endif
+
+// Getters
+const unsigned char *MappedFile::getData(void) const
+{
+	return _pData;
+}
+
+size_t MappedFile::getSize(void) const
+{
+	return _size;
+}
@@ -0,0 +1,166 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "Profiler.h"
+
+#include <chrono>
+#include <fstream>
+
+using namespace ExoRenderer;
+
+std::atomic<bool>				Profiler::_enabled(false);
+thread_local Profiler::ThreadBuffer	*Profiler::_pThreadBuffer = nullptr;
+
+Profiler &Profiler::Get(void)
+{
+	static Profiler	instance;
+
+	return instance;
+}
+
+uint64_t Profiler::now(void)
+{
+	static const std::chrono::steady_clock::time_point	epoch = std::chrono::steady_clock::now();
+
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void Profiler::record(const char *name, uint64_t begin, uint64_t end)
+{
+	ThreadBuffer *buffer = getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer->mutex);
+
+	ProfilerEvent &event = buffer->events[buffer->next];
+	event.name = name;
+	event.begin = begin;
+	event.end = end;
+
+	buffer->next = (buffer->next + 1) % PROFILER_BUFFER_SIZE;
+	if (buffer->next == 0)
+		buffer->full = true;
+}
+
+void Profiler::setThreadName(const char *name)
+{
+	ThreadBuffer *buffer = getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer->mutex);
+
+	buffer->name = name;
+}
+
+bool Profiler::dumpChromeTrace(const std::string &filePath, unsigned int milliseconds)
+{
+	std::ofstream	file(filePath);
+	uint64_t		from = 0;
+	bool			first = true;
+
+	if (!file.is_open())
+		return false;
+
+	if (milliseconds)
+	{
+		uint64_t	window = (uint64_t)milliseconds * 1000000;
+		uint64_t	current = now();
+
+		from = current > window ? current - window : 0;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	for (const std::unique_ptr<ThreadBuffer> &buffer : _buffers)
+	{
+		std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+		size_t count = buffer->full ? PROFILER_BUFFER_SIZE : buffer->next;
+		size_t start = buffer->full ? buffer->next : 0;
+
+		if (!buffer->name.empty())
+		{
+			file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id
+				 << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+			first = false;
+		}
+
+		// Oldest first, timestamps are in microseconds
+		for (size_t i = 0; i < count; i++)
+		{
+			const ProfilerEvent &event = buffer->events[(start + i) % PROFILER_BUFFER_SIZE];
+
+			if (event.end < from)
+				continue ;
+
+			file << (first ? "" : ",") << "\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id
+				 << ",\"ts\":" << event.begin / 1000 << "." << (event.begin % 1000) / 100
+				 << ",\"dur\":" << (event.end - event.begin) / 1000 << "." << ((event.end - event.begin) % 1000) / 100 << "}";
+			first = false;
+		}
+	}
+	file << "\n]}\n";
+
+	return file.good();
+}
+
+void Profiler::clear(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (const std::unique_ptr<ThreadBuffer> &buffer : _buffers)
+	{
+		std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+		buffer->next = 0;
+		buffer->full = false;
+	}
+}
+
+// Setters
+void Profiler::setEnabled(bool enabled)
+{
+	_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+// Private
+Profiler::Profiler(void)
+{	}
+
+Profiler::~Profiler(void)
+{	}
+
+Profiler::ThreadBuffer *Profiler::getThreadBuffer(void)
+{
+	if (_pThreadBuffer)
+		return _pThreadBuffer;
+
+	// First event of this thread, its buffer outlives it so it can still be dumped
+	std::lock_guard<std::mutex> lock(_mutex);
+	ThreadBuffer *buffer = new ThreadBuffer();
+
+	buffer->id = (unsigned int)_buffers.size();
+	buffer->events.resize(PROFILER_BUFFER_SIZE);
+	buffer->next = 0;
+	buffer->full = false;
+	_buffers.emplace_back(buffer);
+
+	_pThreadBuffer = buffer;
+	return buffer;
+}
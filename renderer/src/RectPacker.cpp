@@ -0,0 +1,144 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "RectPacker.h"
+
+#include <algorithm>
+#include <climits>
+
+using namespace ExoRenderer;
+
+RectPacker::RectPacker(int width, int height)
+: _width(width), _height(height)
+{
+	clear();
+}
+
+RectPacker::~RectPacker(void)
+{ }
+
+bool RectPacker::insert(int width, int height, int &x, int &y)
+{
+	size_t	best = _skyline.size();
+	int		bestTop = INT_MAX;
+	int		bestWidth = INT_MAX;
+	int		bestY = 0;
+
+	if (width <= 0 || height <= 0)
+		return false;
+
+	// Lowest top edge, then the narrowest segment to keep wide ones free
+	for (size_t i = 0; i < _skyline.size(); i++)
+	{
+		int top;
+
+		if (fit(i, width, height, top) && (top + height < bestTop || (top + height == bestTop && _skyline[i].width < bestWidth)))
+		{
+			best = i;
+			bestTop = top + height;
+			bestWidth = _skyline[i].width;
+			bestY = top;
+		}
+	}
+	if (best == _skyline.size())
+		return false;
+
+	x = _skyline[best].x;
+	y = bestY;
+	_skyline.insert(_skyline.begin() + best, {x, y + height, width});
+
+	// The new segment shadows the ones it overlaps
+	for (size_t i = best + 1; i < _skyline.size(); )
+	{
+		const Segment	&previous = _skyline[i - 1];
+		int				overlap = previous.x + previous.width - _skyline[i].x;
+
+		if (overlap <= 0)
+			break ;
+		_skyline[i].x += overlap;
+		_skyline[i].width -= overlap;
+		if (_skyline[i].width > 0)
+			break ;
+		_skyline.erase(_skyline.begin() + i);
+	}
+
+	// Neighbours at the same height become one segment
+	for (size_t i = 1; i < _skyline.size(); )
+	{
+		if (_skyline[i - 1].y == _skyline[i].y)
+		{
+			_skyline[i - 1].width += _skyline[i].width;
+			_skyline.erase(_skyline.begin() + i);
+		}
+		else
+			i++;
+	}
+
+	_usedArea += (size_t)width * height;
+	return true;
+}
+
+void RectPacker::clear(void)
+{
+	_skyline.assign(1, {0, 0, _width});
+	_usedArea = 0;
+}
+
+// Getters
+int RectPacker::getWidth(void) const
+{
+	return _width;
+}
+
+int RectPacker::getHeight(void) const
+{
+	return _height;
+}
+
+float RectPacker::getOccupancy(void) const
+{
+	return (float)_usedArea / ((float)_width * _height);
+}
+
+// Private
+bool RectPacker::fit(size_t index, int width, int height, int &y) const
+{
+	int remaining = width;
+
+	if (_skyline[index].x + width > _width)
+		return false;
+
+	// Rests on the highest segment below it
+	y = 0;
+	for (size_t i = index; remaining > 0; i++)
+	{
+		if (i == _skyline.size())
+			return false;
+		y = std::max(y, _skyline[i].y);
+		if (y + height > _height)
+			return false;
+		remaining -= _skyline[i].width;
+	}
+	return true;
+}
@@ -0,0 +1,84 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "RenderStats.h"
+
+using namespace ExoRenderer;
+
+RenderStatsHistory::RenderStatsHistory(size_t capacity)
+: _capacity(capacity ? capacity : 1), _next(0)
+{
+	_stats.reserve(_capacity);
+}
+
+RenderStatsHistory::~RenderStatsHistory(void)
+{	}
+
+void RenderStatsHistory::push(const RenderStats &stats)
+{
+	if (_stats.size() < _capacity)
+		_stats.push_back(stats);
+	else
+		_stats[_next] = stats;
+	_next = (_next + 1) % _capacity;
+}
+
+void RenderStatsHistory::clear(void)
+{
+	_stats.clear();
+	_next = 0;
+}
+
+// Getters
+size_t RenderStatsHistory::getSize(void) const
+{
+	return _stats.size();
+}
+
+size_t RenderStatsHistory::getCapacity(void) const
+{
+	return _capacity;
+}
+
+const RenderStats &RenderStatsHistory::get(size_t index) const
+{
+	// Once full, _next is the oldest frame
+	if (_stats.size() < _capacity)
+		return _stats[index];
+	return _stats[(_next + index) % _capacity];
+}
+
+const RenderStats &RenderStatsHistory::getLast(void) const
+{
+	static const RenderStats	empty;
+
+	if (_stats.empty())
+		return empty;
+	return get(_stats.size() - 1);
+}
+
+double RenderStatsHistory::getFrameTimePercentile(double percentile) const
+{
+	return getPercentile(percentile, &RenderStats::frameTime);
+}
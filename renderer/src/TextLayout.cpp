@@ -0,0 +1,152 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "TextLayout.h"
+#include "Font.h"
+#include "Utf8Iterator.h"
+
+#include <algorithm>
+
+using namespace ExoRenderer;
+
+TextLayout::TextLayout(void)
+: _size(0.0f), _scale(0.0f), _maxWidth(0.0f), _pFont(nullptr), _generation(0)
+{ }
+
+TextLayout::~TextLayout(void)
+{ }
+
+void TextLayout::update(const std::string& text, size_t first, float scale, float maxWidth, const Font& font)
+{
+	size_t		line;
+	size_t		lastSpace = std::string::npos;
+	float		widthAtSpace = 0.0f;
+	uint32_t	previous = 0;
+	TextLine	current;
+
+	if (scale != _scale || maxWidth != _maxWidth || &font != _pFont || font.getGeneration() != _generation)
+	{
+		first = 0;
+		_scale = scale;
+		_maxWidth = maxWidth;
+		_pFont = &font;
+		_generation = font.getGeneration();
+	}
+	if (first > text.length() && !_lines.empty())
+		return ;
+
+	// From the line before the edit, the first word of the next line decides where it wraps
+	line = getLine(std::min(first, text.length()));
+	if (line > 0)
+		line--;
+	_lines.resize(std::min(line, _lines.size()));
+	current.begin = _lines.empty() ? 0 : _lines.back().end + 1;
+	current.end = current.begin;
+	current.width = 0.0f;
+	current.bottom = 0.0f;
+
+	for (Utf8Iterator characters(text, current.begin); characters.hasNext();)
+	{
+		size_t		start = characters.getPosition() - text.data();
+		uint32_t	c = characters.next();
+
+		if (c == '\n')
+		{
+			current.end = start;
+			_lines.push_back(current);
+			current.begin = current.end = start + 1;
+			current.width = current.bottom = 0.0f;
+			lastSpace = std::string::npos;
+			previous = 0;
+			continue ;
+		}
+
+		current.width += font.getKerning(previous, c) * scale;
+		previous = c;
+		if (c == ' ')
+		{
+			lastSpace = start;
+			widthAtSpace = current.width;
+			current.width += TEXT_SPACE_ADVANCE * scale;
+			continue ;
+		}
+
+		const CharDescriptor &ch = font.getCharacter(c);
+		current.width += ch.xAdvance * scale;
+		current.bottom = std::max(current.bottom, (ch.height + ch.yOffset) * scale);
+
+		// Wraps at the last space, the word is measured again on the next line
+		if (maxWidth > 0 && current.width > maxWidth && lastSpace != std::string::npos)
+		{
+			current.end = lastSpace;
+			current.width = widthAtSpace;
+			_lines.push_back(current);
+			characters.setPosition(text.data() + lastSpace + 1);
+			current.begin = current.end = lastSpace + 1;
+			current.width = current.bottom = 0.0f;
+			lastSpace = std::string::npos;
+			previous = 0;
+		}
+	}
+	current.end = text.length();
+	_lines.push_back(current);
+
+	// Cached per line, only summed here
+	_size = glm::vec2(0.0f);
+	for (size_t i = 0; i < _lines.size(); i++)
+	{
+		_size.x = std::max(_size.x, _lines[i].width);
+		_size.y = std::max(_size.y + (i > 0 ? getLineHeight() : 0.0f), _lines[i].bottom);
+	}
+}
+
+void TextLayout::clear(void)
+{
+	_lines.clear();
+	_size = glm::vec2(0.0f);
+	_pFont = nullptr;
+}
+
+// Getters
+const std::vector<TextLine> &TextLayout::getLines(void) const
+{
+	return _lines;
+}
+
+size_t TextLayout::getLine(size_t index) const
+{
+	auto iterator = std::upper_bound(_lines.begin(), _lines.end(), index, [](size_t value, const TextLine& line) { return value < line.begin; });
+
+	return iterator == _lines.begin() ? 0 : (size_t)(iterator - _lines.begin()) - 1;
+}
+
+glm::vec2 TextLayout::getSize(void) const
+{
+	return _size;
+}
+
+float TextLayout::getLineHeight(void) const
+{
+	return TEXT_LINE_HEIGHT * _scale;
+}
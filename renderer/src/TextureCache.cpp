@@ -0,0 +1,187 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "TextureCache.h"
+
+using namespace ExoRenderer;
+
+TextureCache::TextureCache(void)
+: _hits(0), _misses(0)
+{ }
+
+TextureCache::~TextureCache(void)
+{ }
+
+std::shared_ptr<ITexture> TextureCache::getTexture(const std::string &filePath, TextureFilter filter, const TextureFactory &factory)
+{
+	std::string					key = normalizePath(filePath) + '|' + std::to_string((int)filter);
+	std::shared_ptr<ITexture>	texture;
+
+	// Held while loading, two threads asking for the same file load it once
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	std::weak_ptr<ITexture> &entry = _textures[key];
+	texture = entry.lock();
+	if (texture)
+	{
+		_hits++;
+		return texture;
+	}
+
+	_misses++;
+	texture.reset(factory(filePath, filter));
+	entry = texture;
+	return texture;
+}
+
+std::shared_ptr<IArrayTexture> TextureCache::getArrayTexture(int width, int height, const std::vector<std::string> &textures, TextureFilter filter, const ArrayTextureFactory &factory)
+{
+	std::string						key = std::to_string(width) + 'x' + std::to_string(height) + '|' + std::to_string((int)filter);
+	std::vector<std::string>		layers(textures);
+	std::shared_ptr<IArrayTexture>	texture;
+
+	for (const std::string &layer : textures)
+		key += '|' + normalizePath(layer);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	std::weak_ptr<IArrayTexture> &entry = _arrayTextures[key];
+	texture = entry.lock();
+	if (texture)
+	{
+		_hits++;
+		return texture;
+	}
+
+	_misses++;
+	texture.reset(factory(width, height, layers, filter));
+	entry = texture;
+	return texture;
+}
+
+size_t TextureCache::purgeUnused(void)
+{
+	std::lock_guard<std::mutex>	lock(_mutex);
+	size_t						purged = 0;
+
+	for (auto iterator = _textures.begin(); iterator != _textures.end();)
+	{
+		if (iterator->second.expired())
+		{
+			iterator = _textures.erase(iterator);
+			purged++;
+		}
+		else
+			iterator++;
+	}
+
+	for (auto iterator = _arrayTextures.begin(); iterator != _arrayTextures.end();)
+	{
+		if (iterator->second.expired())
+		{
+			iterator = _arrayTextures.erase(iterator);
+			purged++;
+		}
+		else
+			iterator++;
+	}
+
+	return purged;
+}
+
+// Getters
+TextureCacheStats TextureCache::getStats(void)
+{
+	std::lock_guard<std::mutex>	lock(_mutex);
+	TextureCacheStats			stats;
+
+	stats.hits = _hits;
+	stats.misses = _misses;
+	stats.textures = 0;
+	stats.residentBytes = 0;
+
+	// Asked now: asynchronous loads, mip chains, compressed formats and evictions all change it
+	for (const auto &entry : _textures)
+	{
+		std::shared_ptr<ITexture> texture = entry.second.lock();
+
+		if (texture)
+		{
+			stats.textures++;
+			stats.residentBytes += texture->getAllocatedBytes();
+		}
+	}
+
+	for (const auto &entry : _arrayTextures)
+	{
+		std::shared_ptr<IArrayTexture> texture = entry.second.lock();
+
+		if (texture)
+		{
+			stats.textures++;
+			stats.residentBytes += texture->getAllocatedBytes();
+		}
+	}
+
+	return stats;
+}
+
+std::string TextureCache::normalizePath(const std::string &path)
+{
+	std::vector<std::string>	segments;
+	std::string					segment;
+	std::string					result;
+	bool						absolute = !path.empty() && (path[0] == '/' || path[0] == '\\');
+
+	for (size_t i = 0; i <= path.size(); i++)
+	{
+		if (i < path.size() && path[i] != '/' && path[i] != '\\')
+		{
+			segment += path[i];
+			continue ;
+		}
+
+		if (segment == "..")
+		{
+			// Only collapses against a real directory, "../a" stays as is
+			if (!segments.empty() && segments.back() != "..")
+				segments.pop_back();
+			else if (!absolute)
+				segments.push_back(segment);
+		}
+		else if (!segment.empty() && segment != ".")
+			segments.push_back(segment);
+		segment.clear();
+	}
+
+	if (absolute)
+		result += '/';
+	for (size_t i = 0; i < segments.size(); i++)
+	{
+		if (i)
+			result += '/';
+		result += segments[i];
+	}
+	return result;
+}
@@ -0,0 +1,92 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include "ThreadPool.h"
+
+using namespace ExoRenderer;
+
+ThreadPool::ThreadPool(unsigned int workers)
+: _running(true)
+{
+	if (workers == 0)
+		workers = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1;
+
+	for (unsigned int i = 0; i < workers; i++)
+		_workers.emplace_back(&ThreadPool::run, this);
+}
+
+ThreadPool::~ThreadPool(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_running = false;
+		_jobs.clear();
+	}
+	_condition.notify_all();
+
+	for (std::thread &worker : _workers)
+		worker.join();
+}
+
+void ThreadPool::post(const std::function<void(void)> &job)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_jobs.push_back(job);
+	}
+	_condition.notify_one();
+}
+
+// Getters
+unsigned int ThreadPool::getWorkerCount(void) const
+{
+	return (unsigned int)_workers.size();
+}
+
+size_t ThreadPool::getQueuedCount(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _jobs.size();
+}
+
+// Private
+void ThreadPool::run(void)
+{
+	std::function<void(void)>	job;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			_condition.wait(lock, [this]() { return !_running || !_jobs.empty(); });
+			if (!_running)
+				return ;
+
+			job = std::move(_jobs.front());
+			_jobs.pop_front();
+		}
+		job();
+	}
+}
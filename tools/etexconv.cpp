@@ -0,0 +1,172 @@
+/*
+ *	MIT License
+ *
+ *	Copyright (c) 2020 Gaëtan Dezeiraud and Ribault Paul
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include "Texture.h"
+#include "TextureContainer.h"
+
+using namespace ExoRendererSDLOpenGL;
+
+namespace
+{
+
+struct Options
+{
+	bool						mipmaps = false;
+	bool						srgb = false;
+	bool						help = false;
+	std::vector<std::string>	inputs;
+	std::string					output;
+};
+
+void	usage(void)
+{
+	std::cerr << "usage: etexconv [options] <image> [<image>...] <output.etex>\n\n"
+		<< "  Several images become the layers of an array texture, they must have the same size and channels.\n\n"
+		<< "  --mipmaps   store the whole mip chain, box filtered\n"
+		<< "  --srgb      RGBA images are sRGB encoded (GL_SRGB8_ALPHA8)\n";
+}
+
+Options	parseOptions(int argc, char **argv)
+{
+	Options	options;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string	arg(argv[i]);
+
+		if (arg == "--mipmaps")
+			options.mipmaps = true;
+		else if (arg == "--srgb")
+			options.srgb = true;
+		else if (arg == "--help" || arg == "-h")
+			options.help = true;
+		else if (arg.compare(0, 2, "--") == 0)
+			throw (std::invalid_argument("unknown option " + arg));
+		else
+			options.inputs.push_back(arg);
+	}
+
+	if (options.help)
+		return options;
+	if (options.inputs.size() < 2)
+		throw (std::invalid_argument("expects at least an image and an output file"));
+	options.output = options.inputs.back();
+	options.inputs.pop_back();
+	return options;
+}
+
+// Same layout Texture uploads, palettized and gray images are expanded first
+void	convert(const std::string &path, const Options &options, TextureContainer &layer)
+{
+	SDL_Surface	*image = IMG_Load(path.c_str());
+	GLenum		format;
+
+	if (!image)
+		throw (std::runtime_error("cannot load " + path + ": " + IMG_GetError()));
+
+	if (image->format->BytesPerPixel < 3 || image->format->palette)
+	{
+		SDL_Surface *converted = SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_RGBA32, 0);
+
+		SDL_FreeSurface(image);
+		if (!converted)
+			throw (std::runtime_error("cannot convert " + path + ": " + SDL_GetError()));
+		image = converted;
+	}
+
+	format = Texture::getFormat(image->format->BytesPerPixel);
+	try
+	{
+		if (image->format->BytesPerPixel == 4)
+			layer.setImage(options.srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, format, image->w, image->h, (const unsigned char*)image->pixels, image->pitch);
+		else
+			layer.setImage(GL_RGB8, format, image->w, image->h, (const unsigned char*)image->pixels, image->pitch);
+	}
+	catch (...)
+	{
+		SDL_FreeSurface(image);
+		throw ;
+	}
+	SDL_FreeSurface(image);
+}
+
+}
+
+int	main(int argc, char **argv)
+{
+	Options				options;
+	TextureContainer	container;
+
+	try
+	{
+		options = parseOptions(argc, argv);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "etexconv: " << e.what() << "\n\n";
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	if (options.help)
+	{
+		usage();
+		return EXIT_SUCCESS;
+	}
+
+	IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG);
+	try
+	{
+		for (const std::string &input : options.inputs)
+		{
+			TextureContainer	layer;
+
+			convert(input, options, layer);
+			container.appendLayers(layer);
+		}
+		if (options.mipmaps)
+			container.generateMipmaps();
+		container.save(options.output);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "etexconv: " << e.what() << std::endl;
+		IMG_Quit();
+		return EXIT_FAILURE;
+	}
+	IMG_Quit();
+
+	std::cout << options.output << ": " << container.getWidth() << "x" << container.getHeight() << ", "
+		<< container.getLayers() << " layer(s), " << container.getLevels() << " level(s)" << std::endl;
+	return EXIT_SUCCESS;
+}